@@ -504,6 +504,15 @@ function(hpx_check_for_cxx20_coroutines)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_cxx_experimental_simd)
+  add_hpx_config_test(
+    HPX_WITH_CXX_EXPERIMENTAL_SIMD
+    SOURCE cmake/tests/cxx_experimental_simd.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_cxx20_std_disable_sized_sentinel_for)
   add_hpx_config_test(
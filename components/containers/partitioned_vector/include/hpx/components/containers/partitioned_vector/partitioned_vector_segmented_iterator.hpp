@@ -1098,6 +1098,36 @@ namespace hpx { namespace traits
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The partition data decides about the execution policy for a segment
+    // (e.g. compute::vector allocated with a block_allocator runs the
+    // algorithms on the targets its memory was bound to)
+    template <typename T, typename Data, typename BaseIter>
+    struct segmented_local_policy<
+        local_raw_vector_iterator<T, Data, BaseIter> >
+    {
+        template <typename ExPolicy>
+        static decltype(auto) call(ExPolicy&& policy,
+            local_raw_vector_iterator<T, Data, BaseIter> const& it)
+        {
+            return segmented_local_policy<BaseIter>::call(
+                std::forward<ExPolicy>(policy), it.base());
+        }
+    };
+
+    template <typename T, typename Data, typename BaseIter>
+    struct segmented_local_policy<
+        const_local_raw_vector_iterator<T, Data, BaseIter> >
+    {
+        template <typename ExPolicy>
+        static decltype(auto) call(ExPolicy&& policy,
+            const_local_raw_vector_iterator<T, Data, BaseIter> const& it)
+        {
+            return segmented_local_policy<BaseIter>::call(
+                std::forward<ExPolicy>(policy), it.base());
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data>
     struct is_value_proxy<hpx::detail::local_vector_value_proxy<T, Data> >
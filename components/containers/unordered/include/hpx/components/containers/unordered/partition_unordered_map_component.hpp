@@ -36,8 +36,11 @@
 #include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/components/server/simple_component_base.hpp>
 #include <hpx/runtime/get_ptr.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -71,9 +74,37 @@ namespace hpx { namespace server
                     partition_unordered_map<Key, T, Hash, KeyEqual> > >
             base_type;
 
+        /// The values returned by \a get_values_versioned together with the
+        /// version of the partition they were read from.
+        struct versioned_values
+        {
+            versioned_values()
+              : version_(0)
+            {}
+
+            versioned_values(std::uint64_t version, std::vector<T> && values)
+              : version_(version), values_(std::move(values))
+            {}
+
+            std::uint64_t version_;
+            std::vector<T> values_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & version_ & values_;
+            }
+        };
+
     private:
         data_type partition_unordered_map_;
 
+        // incremented by every operation modifying the partition
+        std::uint64_t version_;
+
     public:
         ///////////////////////////////////////////////////////////////////////
         // Constructors
@@ -82,22 +113,24 @@ namespace hpx { namespace server
         /// Default Constructor which create partition_unordered_map
         /// with size 0.
         partition_unordered_map()
+          : version_(0)
         {
         }
 
         explicit partition_unordered_map(size_type bucket_count)
-          : partition_unordered_map_(bucket_count)
+          : partition_unordered_map_(bucket_count), version_(0)
         {}
 
         partition_unordered_map(size_type bucket_count, Hash const& hash,
                 KeyEqual const& equal)
-          : partition_unordered_map_(bucket_count, hash, equal)
+          : partition_unordered_map_(bucket_count, hash, equal), version_(0)
         {}
 
         // support components::copy
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs),
-            partition_unordered_map_(rhs.partition_unordered_map_)
+            partition_unordered_map_(rhs.partition_unordered_map_),
+            version_(rhs.version_)
         {}
 
         partition_unordered_map& operator=(partition_unordered_map const& rhs)
@@ -106,13 +139,15 @@ namespace hpx { namespace server
             {
                 this->base_type::operator=(rhs);
                 partition_unordered_map_ = rhs.partition_unordered_map_;
+                ++version_;
             }
             return *this;
         }
 
         partition_unordered_map(partition_unordered_map && rhs)
           : base_type(std::move(rhs)),
-            partition_unordered_map_(std::move(rhs.partition_unordered_map_))
+            partition_unordered_map_(std::move(rhs.partition_unordered_map_)),
+            version_(rhs.version_)
         {}
 
         partition_unordered_map& operator=(partition_unordered_map && rhs)
@@ -121,6 +156,7 @@ namespace hpx { namespace server
             {
                 this->base_type::operator=(std::move(rhs));
                 partition_unordered_map_ = std::move(rhs.partition_unordered_map_);
+                ++version_;
             }
             return *this;
         }
@@ -133,6 +169,15 @@ namespace hpx { namespace server
         void set_copied_data(data_type && d)
         {
             partition_unordered_map_ = std::move(d);
+            ++version_;
+        }
+
+        /// Return the current version of this partition. The version changes
+        /// whenever the partition is modified, which allows clients to
+        /// detect stale copies of its elements.
+        std::uint64_t get_version() const
+        {
+            return version_;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -232,6 +277,7 @@ namespace hpx { namespace server
             if (!erase)
                 return it->second;
 
+            ++version_;
             erase_on_exit t(partition_unordered_map_, it);
             return it->second;
         }
@@ -266,6 +312,16 @@ namespace hpx { namespace server
             return result;
         }
 
+        /// Return the elements with the given keys together with the version
+        /// of this partition they correspond to.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        ///
+        versioned_values get_values_versioned(std::vector<Key> const& keys)
+        {
+            return versioned_values(version_, get_values(keys));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
@@ -280,6 +336,7 @@ namespace hpx { namespace server
         void set_value(Key const& pos, T const& val)
         {
             partition_unordered_map_[pos] = val;
+            ++version_;
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -293,10 +350,10 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
                 partition_unordered_map_[keys[i]] = val[i];
+            ++version_;
         }
 
         /// Remove all elements from the vector leaving the
@@ -305,11 +362,13 @@ namespace hpx { namespace server
         void clear()
         {
             partition_unordered_map_.clear();
+            ++version_;
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
+            ++version_;
             return partition_unordered_map_.erase(key);
         }
 
@@ -318,6 +377,10 @@ namespace hpx { namespace server
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, get_values_versioned);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, get_version);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values);
@@ -360,6 +423,13 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,     \
         HPX_PP_CAT(__unordered_map_get_values_action_, name));                \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_values_versioned_action,                                      \
+        HPX_PP_CAT(__unordered_map_get_values_versioned_action_, name));      \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_version_action,    \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name));               \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,      \
         HPX_PP_CAT(__unordered_map_set_value_action_, name));                 \
@@ -419,6 +489,13 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,     \
         HPX_PP_CAT(__unordered_map_get_values_action_, name));                \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_values_versioned_action,                                      \
+        HPX_PP_CAT(__unordered_map_get_values_versioned_action_, name));      \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_version_action,    \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name));               \
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,      \
         HPX_PP_CAT(__unordered_map_set_value_action_, name));                 \
@@ -569,6 +646,36 @@ namespace hpx
                 this->get_id(), keys);
         }
 
+        /// Return the elements with the given keys in the
+        /// partition_unordered_map container together with the version of
+        /// the partition they were read from.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the values and the version as the
+        ///         hpx::future
+        ///
+        future<typename server_type::versioned_values>
+        get_values_versioned(std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                    typename server_type::get_values_versioned_action
+                >(this->get_id(), keys);
+        }
+
+        /// Return the current version of the partition_unordered_map
+        /// component, the version changes whenever the partition is modified.
+        ///
+        /// \return This returns the version as the hpx::future
+        ///
+        future<std::uint64_t> get_version() const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::get_version_action>(
+                this->get_id());
+        }
+
         /// Copy the value of \a val in the element at position
         /// \a pos in the partition_unordered_map container.
         ///
@@ -12,28 +12,35 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/copy_component.hpp>
 #include <hpx/runtime/components/new.hpp>
 #include <hpx/runtime/components/server/distributed_metadata_base.hpp>
+#include <hpx/runtime/find_here.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/unordered_map.hpp>
 #include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/traits/is_distribution_policy.hpp>
 
 #include <hpx/components/containers/container_distribution_policy.hpp>
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 #include <hpx/components/containers/unordered/unordered_map_segmented_iterator.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -50,7 +57,8 @@ namespace hpx { namespace server
     struct unordered_map_config_data
     {
         // Each partition is described by it's corresponding client object, its
-        // size, and locality id.
+        // size, locality id, and the tokens it owns on the hash ring (if
+        // consistent hashing is used).
         struct partition_data
         {
             partition_data()
@@ -69,6 +77,7 @@ namespace hpx { namespace server
 
             hpx::shared_future<id_type> partition_;
             std::uint32_t locality_id_;
+            std::vector<std::uint64_t> tokens_;
 
         private:
             friend class hpx::serialization::access;
@@ -76,7 +85,7 @@ namespace hpx { namespace server
             template <typename Archive>
             void serialize(Archive& ar, unsigned)
             {
-                ar & partition_ & locality_id_;
+                ar & partition_ & locality_id_ & tokens_;
             }
         };
 
@@ -138,6 +147,163 @@ namespace hpx
             Key const& key_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Consistent hashing relies on the tokens and the hashed keys being
+        // evenly distributed, which is not true for many hash functions
+        // (std::hash for integers is the identity). This is the finalizer of
+        // splitmix64.
+        inline std::uint64_t mix_hash(std::uint64_t h)
+        {
+            h ^= h >> 30;
+            h *= 0xbf58476d1ce4e5b9ULL;
+            h ^= h >> 27;
+            h *= 0x94d049bb133111ebULL;
+            h ^= h >> 31;
+            return h;
+        }
+
+        // The hash ring used for consistent hashing. Each partition owns a
+        // number of tokens (virtual nodes) on the ring, a key belongs to the
+        // partition owning the first token following the key's hash value.
+        class unordered_map_ring
+        {
+            typedef std::pair<std::uint64_t, std::size_t> token_type;
+
+        public:
+            bool empty() const
+            {
+                return tokens_.empty();
+            }
+
+            template <typename Partitions>
+            void assign(Partitions const& partitions)
+            {
+                tokens_.clear();
+                for (std::size_t part = 0; part != partitions.size(); ++part)
+                {
+                    for (std::uint64_t token : partitions[part].tokens_)
+                        tokens_.push_back(token_type(token, part));
+                }
+                std::sort(tokens_.begin(), tokens_.end());
+            }
+
+            std::size_t find(std::uint64_t hash) const
+            {
+                HPX_ASSERT(!tokens_.empty());
+
+                auto it = std::upper_bound(tokens_.begin(), tokens_.end(),
+                    hash, [](std::uint64_t h, token_type const& t) {
+                        return h < t.first;
+                    });
+                if (it == tokens_.end())
+                    it = tokens_.begin();
+                return it->second;
+            }
+
+        private:
+            std::vector<token_type> tokens_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The read cache of a hpx::unordered_map holds copies of elements of
+        // remote partitions. The elements of each partition are tagged with
+        // the version of the partition they were read from. Versions of a
+        // partition only ever increase, seeing a newer version drops all
+        // elements cached for that partition.
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        class unordered_map_cache
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+            struct partition_cache
+            {
+                partition_cache()
+                  : version_(0)
+                {}
+
+                std::uint64_t version_;
+                std::unordered_map<Key, T, Hash, KeyEqual> data_;
+            };
+
+        public:
+            explicit unordered_map_cache(std::size_t num_partitions)
+              : partitions_(num_partitions)
+            {}
+
+            bool find(std::size_t part, Key const& key, T& value) const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                partition_cache const& pc = partitions_[part];
+                auto it = pc.data_.find(key);
+                if (it == pc.data_.end())
+                    return false;
+
+                value = it->second;
+                return true;
+            }
+
+            bool empty(std::size_t part) const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                return partitions_[part].data_.empty();
+            }
+
+            // store the given elements read from version 'version' of the
+            // partition
+            void update(std::size_t part, std::uint64_t version,
+                std::vector<Key> const& keys, std::vector<T> const& values)
+            {
+                HPX_ASSERT(keys.size() == values.size());
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                partition_cache& pc = partitions_[part];
+                if (version < pc.version_)
+                    return;     // the elements are older than the cache
+
+                if (version > pc.version_)
+                {
+                    pc.data_.clear();
+                    pc.version_ = version;
+                }
+
+                for (std::size_t i = 0; i != keys.size(); ++i)
+                    pc.data_[keys[i]] = values[i];
+            }
+
+            // drop the cached elements if the partition has changed since
+            // they were read
+            void validate(std::size_t part, std::uint64_t version)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                partition_cache& pc = partitions_[part];
+                if (version > pc.version_)
+                {
+                    pc.data_.clear();
+                    pc.version_ = version;
+                }
+            }
+
+            void erase(std::size_t part, Key const& key)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                partitions_[part].data_.erase(key);
+            }
+
+            void clear()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                for (partition_cache& pc : partitions_)
+                    pc.data_.clear();
+            }
+
+        private:
+            mutable mutex_type mtx_;
+            std::vector<partition_cache> partitions_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Hash, typename IsEmpty = std::is_empty<Hash> >
         struct unordered_hasher
@@ -267,6 +433,8 @@ namespace hpx
             partition_unordered_map_server;
         typedef hpx::partition_unordered_map<Key, T, Hash, KeyEqual>
             partition_unordered_map_client;
+        typedef detail::unordered_map_cache<Key, T, Hash, KeyEqual>
+            cache_type;
 
         struct partition_data
           : server::unordered_map_config_data::partition_data
@@ -312,6 +480,13 @@ namespace hpx
         // global ID's of the underlying partitioned_vector_partitions.
         partitions_vector_type partitions_;
 
+        // The hash ring mapping keys to partitions, empty unless consistent
+        // hashing is used
+        detail::unordered_map_ring ring_;
+
+        // The optional read cache for the elements of remote partitions
+        std::shared_ptr<cache_type> cache_;
+
         ///////////////////////////////////////////////////////////////////////
         // Connect this unordered_map to the existing unordered_mapusing the
         // given symbolic name.
@@ -323,6 +498,10 @@ namespace hpx
 
             std::move(data.partitions_.begin(), data.partitions_.end(),
                 std::back_inserter(partitions_));
+            ring_.assign(partitions_);
+
+            if (cache_)
+                cache_ = std::make_shared<cache_type>(partitions_.size());
 
             base_type::reset(std::move(id));
         }
@@ -342,7 +521,9 @@ namespace hpx
         ///////////////////////////////////////////////////////////////////////
         std::size_t get_partition(Key const& key) const
         {
-            return this->hasher_(key) % partitions_.size();
+            if (ring_.empty())
+                return this->hasher_(key) % partitions_.size();
+            return ring_.find(detail::mix_hash(this->hasher_(key)));
         }
 
         std::vector<hpx::id_type> get_partition_ids() const
@@ -465,6 +646,7 @@ namespace hpx
                 std::uint32_t locality = rhs.partitions_[i].locality_id_;
 
                 partitions.push_back(partition_data(objs[i].get(), locality));
+                partitions.back().tokens_ = rhs.partitions_[i].tokens_;
 
                 if (locality == this_locality)
                 {
@@ -477,6 +659,134 @@ namespace hpx
             wait_all(ptrs);
 
             std::swap(partitions_, partitions);
+            ring_ = rhs.ring_;
+
+            cache_.reset();
+            if (rhs.cache_)
+                cache_ = std::make_shared<cache_type>(partitions_.size());
+        }
+
+        // Return the cache if the elements of the given partition are cached
+        cache_type* get_cache(size_type part) const
+        {
+            if (partitions_[part].local_data_)
+                return nullptr;
+            return cache_.get();
+        }
+
+        // Read a single element through the cache
+        future<T> get_cached_value(size_type part, Key const& pos) const
+        {
+            T value;
+            if (cache_->find(part, pos, value))
+                return make_ready_future(std::move(value));
+
+            std::shared_ptr<cache_type> cache = cache_;
+            std::vector<Key> keys(1, pos);
+            return partition_unordered_map_client(partitions_[part].partition_)
+                .get_values_versioned(keys)
+                .then(launch::sync,
+                    [cache, part, keys](
+                        future<typename partition_unordered_map_server::
+                                versioned_values>&& f) -> T {
+                        auto v = f.get();
+                        cache->update(part, v.version_, keys, v.values_);
+                        return std::move(v.values_[0]);
+                    });
+        }
+
+        // Wait for all of the given futures, rethrowing the first exception
+        static void get_all(future<std::vector<future<void> > >&& f)
+        {
+            std::vector<future<void> > results = f.get();
+            for (future<void>& r : results)
+                r.get();
+        }
+
+        // Create a new (empty) partition on the given locality
+        partition_data create_partition(id_type const& locality) const
+        {
+            id_type id =
+                hpx::new_<partition_unordered_map_server>(locality).get();
+
+            std::uint32_t locality_id = naming::get_locality_id_from_id(id);
+            partition_data part(id, locality_id);
+            if (locality_id == get_locality_id())
+            {
+                part.local_data_ =
+                    get_ptr<partition_unordered_map_server>(launch::sync, id);
+            }
+            return part;
+        }
+
+        // Move all elements of the partitions 'sources' which are owned by
+        // a different partition according to the tokens currently stored in
+        // partitions_ to their new owners. The elements are inserted into
+        // the new owners before the new ring becomes active and are removed
+        // from the sources afterwards, lookups through this instance find
+        // all elements at any time.
+        void redistribute(std::vector<std::size_t> const& sources)
+        {
+            detail::unordered_map_ring ring;
+            ring.assign(partitions_);
+
+            auto owner = [&](Key const& key) -> std::size_t {
+                if (ring.empty())
+                    return this->hasher_(key) % partitions_.size();
+                return ring.find(detail::mix_hash(this->hasher_(key)));
+            };
+
+            std::vector<future<partition_data_type> > data;
+            data.reserve(sources.size());
+            for (std::size_t src : sources)
+                data.push_back(partitions_[src].get_data());
+
+            std::vector<partition_data_type> kept(sources.size());
+            std::vector<std::vector<Key> > keys(partitions_.size());
+            std::vector<std::vector<T> > values(partitions_.size());
+            for (std::size_t i = 0; i != sources.size(); ++i)
+            {
+                for (auto& elem : data[i].get())
+                {
+                    std::size_t part = owner(elem.first);
+                    if (part == sources[i])
+                    {
+                        kept[i].insert(std::move(elem));
+                        continue;
+                    }
+                    keys[part].push_back(elem.first);
+                    values[part].push_back(std::move(elem.second));
+                }
+            }
+
+            std::vector<future<void> > moved;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (keys[part].empty())
+                    continue;
+
+                moved.push_back(
+                    partition_unordered_map_client(partitions_[part].partition_)
+                        .set_values(keys[part], values[part]));
+            }
+            wait_all(moved);
+            for (future<void>& f : moved)
+                f.get();
+
+            ring_ = std::move(ring);
+            if (cache_)
+                cache_ = std::make_shared<cache_type>(partitions_.size());
+
+            std::vector<future<void> > pruned;
+            pruned.reserve(sources.size());
+            for (std::size_t i = 0; i != sources.size(); ++i)
+            {
+                pruned.push_back(
+                    partitions_[sources[i]].set_data(std::move(kept[i])));
+            }
+            wait_all(pruned);
+            for (future<void>& f : pruned)
+                f.get();
         }
 
     public:
@@ -574,7 +884,9 @@ namespace hpx
         unordered_map(unordered_map && rhs)
           : base_type(std::move(rhs)),
             hash_base_type(std::move(rhs)),
-            partitions_(std::move(rhs.partitions_))
+            partitions_(std::move(rhs.partitions_)),
+            ring_(std::move(rhs.ring_)),
+            cache_(std::move(rhs.cache_))
         {}
 
         unordered_map& operator=(unordered_map const& rhs)
@@ -593,6 +905,8 @@ namespace hpx
                     std::move(static_cast<hash_base_type&&>(rhs)));
 
                 partitions_ = std::move(rhs.partitions_);
+                ring_ = std::move(rhs.ring_);
+                cache_ = std::move(rhs.cache_);
             }
             return *this;
         }
@@ -658,6 +972,13 @@ namespace hpx
             if (part_data.local_data_)
                 return part_data.local_data_->get_value(pos, erase);
 
+            if (cache_type* cache = get_cache(part))
+            {
+                if (!erase)
+                    return get_cached_value(part, pos).get();
+                cache->erase(part, pos);
+            }
+
             return partition_unordered_map_client(part_data.partition_)
                 .get_value(launch::sync, pos, erase);
         }
@@ -695,10 +1016,122 @@ namespace hpx
                     partitions_[part].local_data_->get_value(pos, erase));
             }
 
+            if (cache_type* cache = get_cache(part))
+            {
+                if (!erase)
+                    return get_cached_value(part, pos);
+                cache->erase(part, pos);
+            }
+
             return partition_unordered_map_client(partitions_[part].partition_)
                 .get_value(pos, erase);
         }
 
+        /// Returns the elements with the given keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the same order as
+        ///         their keys in \a keys.
+        ///
+        std::vector<T>
+        get_values(launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the elements with the given keys in the
+        /// unordered_map container. The keys are grouped by the partition
+        /// they belong to, all elements of a remote partition are retrieved
+        /// using a single action.
+        ///
+        /// \param keys Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the same order as their keys in \a keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            std::shared_ptr<std::vector<T> > result =
+                std::make_shared<std::vector<T> >(keys.size());
+
+            // group the keys by partition, remembering their positions
+            std::vector<std::vector<Key> > part_keys(partitions_.size());
+            std::vector<std::vector<std::size_t> > part_pos(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+
+                cache_type* cache = get_cache(part);
+                if (cache && cache->find(part, keys[i], (*result)[i]))
+                    continue;
+
+                part_keys[part].push_back(keys[i]);
+                part_pos[part].push_back(i);
+            }
+
+            std::vector<future<void> > lazy_values;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    std::vector<T> values =
+                        part_data.local_data_->get_values(part_keys[part]);
+                    for (std::size_t i = 0; i != values.size(); ++i)
+                        (*result)[part_pos[part][i]] = std::move(values[i]);
+                    continue;
+                }
+
+                partition_unordered_map_client client(part_data.partition_);
+                if (get_cache(part) != nullptr)
+                {
+                    lazy_values.push_back(
+                        client.get_values_versioned(part_keys[part]).then(
+                            launch::sync,
+                            [cache = cache_, result, part,
+                                keys = std::move(part_keys[part]),
+                                pos = std::move(part_pos[part])](
+                                future<typename partition_unordered_map_server::
+                                        versioned_values>&& f) {
+                                auto v = f.get();
+                                cache->update(
+                                    part, v.version_, keys, v.values_);
+                                for (std::size_t i = 0; i != pos.size(); ++i)
+                                {
+                                    (*result)[pos[i]] =
+                                        std::move(v.values_[i]);
+                                }
+                            }));
+                }
+                else
+                {
+                    lazy_values.push_back(
+                        client.get_values(part_keys[part]).then(launch::sync,
+                            [result, pos = std::move(part_pos[part])](
+                                future<std::vector<T> >&& f) {
+                                std::vector<T> values = f.get();
+                                for (std::size_t i = 0; i != pos.size(); ++i)
+                                    (*result)[pos[i]] = std::move(values[i]);
+                            }));
+                }
+            }
+
+            if (lazy_values.empty())
+                return make_ready_future(std::move(*result));
+
+            return when_all(std::move(lazy_values)).then(launch::sync,
+                [result](future<std::vector<future<void> > >&& f)
+                    -> std::vector<T> {
+                    get_all(std::move(f));
+                    return std::move(*result);
+                });
+        }
+
         /// Copy the value of \a val in the element at position \a pos in
         /// the unordered_map container.
         ///
@@ -732,6 +1165,9 @@ namespace hpx
             }
             else
             {
+                if (cache_type* cache = get_cache(part))
+                    cache->erase(part, pos);
+
                 partition_unordered_map_client(part_data.partition_)
                     .set_value(launch::sync, pos, std::forward<T_>(val));
             }
@@ -774,10 +1210,82 @@ namespace hpx
                 return make_ready_future();
             }
 
+            if (cache_type* cache = get_cache(part))
+                cache->erase(part, pos);
+
             return partition_unordered_map_client(part_data.partition_)
                 .set_value(pos, std::forward<T_>(val));
         }
 
+        /// Copy the values \a vals to the elements with the given keys in
+        /// the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the unordered_map container. The keys are grouped
+        /// by the partition they belong to, all elements of a remote
+        /// partition are updated using a single action.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<Key> > part_keys(partitions_.size());
+            std::vector<std::vector<T> > part_vals(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_vals[part].push_back(vals[i]);
+            }
+
+            std::vector<future<void> > lazy_results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->set_values(
+                        part_keys[part], part_vals[part]);
+                    continue;
+                }
+
+                if (cache_type* cache = get_cache(part))
+                {
+                    for (Key const& key : part_keys[part])
+                        cache->erase(part, key);
+                }
+
+                lazy_results.push_back(
+                    partition_unordered_map_client(part_data.partition_)
+                        .set_values(part_keys[part], part_vals[part]));
+            }
+
+            if (lazy_results.empty())
+                return make_ready_future();
+
+            return when_all(std::move(lazy_results))
+                .then(launch::sync, &get_all);
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -822,6 +1330,9 @@ namespace hpx
             if (part_data.local_data_)
                 return part_data.local_data_->erase(key);
 
+            if (cache_type* cache = get_cache(part))
+                cache->erase(part, key);
+
             return partition_unordered_map_client(
                 part_data.partition_).erase(launch::sync, key);
         }
@@ -847,10 +1358,213 @@ namespace hpx
             if (part_data.local_data_)
                 return make_ready_future(part_data.local_data_->erase(key));
 
+            if (cache_type* cache = get_cache(part))
+                cache->erase(part, key);
+
             return partition_unordered_map_client(
                 part_data.partition_).erase(key);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        /// Enable or disable the read cache of this unordered_map instance.
+        ///
+        /// If enabled, elements read from remote partitions are kept in a
+        /// cache local to this instance and subsequent reads of the same
+        /// keys are served without communicating with the partition. Writes
+        /// issued through this instance drop the affected elements from the
+        /// cache. Modifications made through other instances (for instance
+        /// on other localities) become visible once \a validate_cache has
+        /// detected the change of the modified partition or once another
+        /// read from that partition returned its newer version.
+        ///
+        /// The cache is meant for read-mostly tables. This function must not
+        /// be called concurrently with other operations on this instance.
+        ///
+        /// \param enable  Enable the cache if true, disable it otherwise
+        ///
+        void enable_cache(bool enable = true)
+        {
+            if (!enable)
+                cache_.reset();
+            else if (!cache_)
+                cache_ = std::make_shared<cache_type>(partitions_.size());
+        }
+
+        /// Return whether the read cache of this instance is enabled
+        bool is_cache_enabled() const
+        {
+            return cache_ != nullptr;
+        }
+
+        /// Drop all elements from the read cache of this instance.
+        void clear_cache()
+        {
+            if (cache_)
+                cache_->clear();
+        }
+
+        /// Asynchronously compare the versions of the cached elements with
+        /// the current versions of their partitions, dropping the elements
+        /// of all partitions which have been modified since the elements
+        /// were read. This requires one action for each remote partition
+        /// elements are cached for.
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the cache has been validated.
+        ///
+        future<void> validate_cache() const
+        {
+            std::vector<future<void> > lazy_results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                cache_type* cache = get_cache(part);
+                if (!cache || cache->empty(part))
+                    continue;
+
+                lazy_results.push_back(
+                    partition_unordered_map_client(partitions_[part].partition_)
+                        .get_version()
+                        .then(launch::sync,
+                            [cache = cache_, part](
+                                future<std::uint64_t>&& f) {
+                                cache->validate(part, f.get());
+                            }));
+            }
+
+            if (lazy_results.empty())
+                return make_ready_future();
+
+            return when_all(std::move(lazy_results))
+                .then(launch::sync, &get_all);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Switch this unordered_map to consistent hashing. Each partition is
+        /// assigned \a virtual_nodes tokens on a hash ring and each key
+        /// belongs to the partition owning the first token following the
+        /// (mixed) hash value of the key. Existing elements are moved to
+        /// their new partitions.
+        ///
+        /// Consistent hashing allows to split and migrate partitions of the
+        /// unordered_map (see \a split_partition and \a migrate_partition)
+        /// while moving only the elements of the affected partition.
+        ///
+        /// \param virtual_nodes  The number of tokens assigned to each
+        ///                       partition
+        ///
+        /// \note This function blocks until all elements have been moved.
+        ///       Other instances connected to the same unordered_map (see
+        ///       \a connect_to) have to reconnect to observe the new
+        ///       partitioning.
+        ///
+        void enable_consistent_hashing(std::size_t virtual_nodes = 64)
+        {
+            if (virtual_nodes == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "unordered_map::enable_consistent_hashing",
+                    "the number of virtual nodes must be larger than zero");
+            }
+
+            std::vector<std::size_t> sources(partitions_.size());
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                std::vector<std::uint64_t>& tokens = partitions_[part].tokens_;
+
+                tokens.clear();
+                tokens.reserve(virtual_nodes);
+                for (std::size_t i = 0; i != virtual_nodes; ++i)
+                {
+                    tokens.push_back(detail::mix_hash(
+                        (std::uint64_t(part) << 32) + std::uint64_t(i)));
+                }
+                sources[part] = part;
+            }
+
+            redistribute(sources);
+        }
+
+        /// Return whether this unordered_map uses consistent hashing
+        bool uses_consistent_hashing() const
+        {
+            return !ring_.empty();
+        }
+
+        /// Split the partition \a part by creating a new partition on the
+        /// given locality which takes over every other token of \a part.
+        /// Only the elements of \a part are moved. This is used to relieve
+        /// partitions holding hot or many keys and to grow the unordered_map
+        /// onto new localities. The new partition is appended to the list of
+        /// partitions.
+        ///
+        /// \param part      Sequence number of the partition to split
+        /// \param locality  The locality to create the new partition on
+        ///
+        /// \note This function requires consistent hashing to be enabled
+        ///       and blocks until all elements have been moved. The elements
+        ///       of \a part must not be modified while it is split.
+        ///
+        void split_partition(size_type part, id_type const& locality)
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            if (ring_.empty())
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "unordered_map::split_partition",
+                    "splitting a partition requires consistent hashing");
+            }
+
+            std::vector<std::uint64_t>& tokens = partitions_[part].tokens_;
+            if (tokens.size() < 2)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "unordered_map::split_partition",
+                    "the partition owns too few tokens to be split");
+            }
+
+            partition_data new_part = create_partition(locality);
+
+            std::vector<std::uint64_t> kept;
+            kept.reserve(tokens.size() - tokens.size() / 2);
+            for (std::size_t i = 0; i != tokens.size(); ++i)
+            {
+                if (i % 2 == 0)
+                    kept.push_back(tokens[i]);
+                else
+                    new_part.tokens_.push_back(tokens[i]);
+            }
+            tokens = std::move(kept);
+
+            partitions_.push_back(std::move(new_part));
+            redistribute(std::vector<std::size_t>(1, part));
+        }
+
+        /// Migrate the partition \a part to the given locality. A new
+        /// partition is created on that locality, it receives all elements
+        /// and the tokens of \a part and replaces it.
+        ///
+        /// \param part      Sequence number of the partition to migrate
+        /// \param locality  The locality to migrate the partition to
+        ///
+        /// \note This function blocks until all elements have been moved.
+        ///       The elements of \a part must not be modified while it is
+        ///       migrated.
+        ///
+        void migrate_partition(size_type part, id_type const& locality)
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data new_part = create_partition(locality);
+            new_part.tokens_ = partitions_[part].tokens_;
+
+            new_part.set_data(partitions_[part].get_data().get()).get();
+
+            partitions_[part] = std::move(new_part);
+            if (cache_)
+                cache_ = std::make_shared<cache_type>(partitions_.size());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segment_unordered_map_iterator<
                 Key, T, Hash, KeyEqual,
@@ -152,6 +152,100 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_tests(DistPolicy const& policy, std::string const& name)
+{
+    hpx::unordered_map<Key, Value> m(17, policy);
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != 107; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), std::size_t(107));
+
+    // the values are returned in the order of the requested keys
+    std::reverse(keys.begin(), keys.end());
+    std::reverse(values.begin(), values.end());
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == values);
+
+    // reads through the cache return the same values
+    m.enable_cache();
+    HPX_TEST(m.is_cache_enabled());
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == values);
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == values);
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[0]), values[0]);
+
+    // writes through this instance are visible immediately
+    m.set_value(hpx::launch::sync, keys[0], Value(-1));
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[0]), Value(-1));
+
+    // writes through other instances are visible once the cache was
+    // validated
+    m.register_as(name).get();
+
+    hpx::unordered_map<Key, Value> other;
+    other.connect_to(name).get();
+    other.set_value(hpx::launch::sync, keys[1], Value(-2));
+
+    m.validate_cache().get();
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[1]), Value(-2));
+
+    m.enable_cache(false);
+    HPX_TEST(!m.is_cache_enabled());
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[1]), Value(-2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value>
+void check_values(hpx::unordered_map<Key, Value>& m, std::size_t count)
+{
+    HPX_TEST_EQ(m.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(
+            m.get_value(hpx::launch::sync, std::to_string(i)), Value(i));
+    }
+}
+
+template <typename Key, typename Value, typename DistPolicy>
+void consistent_hashing_tests(DistPolicy const& policy)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::unordered_map<Key, Value> m(17, policy);
+    HPX_TEST(!m.uses_consistent_hashing());
+
+    for (std::size_t i = 0; i != 107; ++i)
+        m[std::to_string(i)] = Value(i);
+
+    // existing elements are moved to their new partitions
+    m.enable_consistent_hashing(16);
+    HPX_TEST(m.uses_consistent_hashing());
+    check_values(m, 107);
+
+    // splitting adds a partition on the given locality
+    std::size_t num_partitions = m.get_num_partitions();
+    m.split_partition(0, localities.back());
+    HPX_TEST_EQ(m.get_num_partitions(), num_partitions + 1);
+    check_values(m, 107);
+
+    // new elements are distributed using the new partitioning
+    for (std::size_t i = 107; i != 223; ++i)
+        m[std::to_string(i)] = Value(i);
+    check_values(m, 223);
+
+    // migration keeps all elements and the partitioning
+    m.migrate_partition(0, localities.back());
+    HPX_TEST_EQ(m.get_num_partitions(), num_partitions + 1);
+    check_values(m, 223);
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
@@ -163,6 +257,15 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
+    bulk_tests<std::string, double>(
+        hpx::container_layout(3), "/test/unordered_map/bulk/1");
+    bulk_tests<std::string, double>(
+        hpx::container_layout(3, localities), "/test/unordered_map/bulk/2");
+
+    consistent_hashing_tests<std::string, double>(hpx::container_layout(3));
+    consistent_hashing_tests<std::string, double>(
+        hpx::container_layout(3, localities));
+
     return 0;
 }
 #endif
@@ -0,0 +1,288 @@
+//  Copyright (c) 2014 Hartmut Kaiser
+//  Copyright (c) 2014 Patricia Grubel
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example is a variation of example four. Instead of building a new
+// dataflow graph for every time step, it captures the dependencies of 'nd'
+// time steps once in a task graph and replays that graph until all time
+// steps have been computed. Replaying the graph does not allocate any shared
+// states or attach any continuations, all partitions are updated in place
+// using two buffers which are swapped from one time step to the next.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos_local.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "print_time_results.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Command-line variables
+bool header = true;    // print csv heading
+double k = 0.5;        // heat transfer coefficient
+double dt = 1.;        // time step
+double dx = 1.;        // grid spacing
+
+inline std::size_t idx(std::size_t i, int dir, std::size_t size)
+{
+    if (i == 0 && dir == -1)
+        return size - 1;
+    if (i == size - 1 && dir == +1)
+        return 0;
+
+    HPX_ASSERT((i + dir) < size);
+
+    return i + dir;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Our partition data type
+struct partition_data
+{
+public:
+    explicit partition_data(std::size_t size)
+      : data_(new double[size])
+      , size_(size)
+    {
+    }
+
+    partition_data(std::size_t size, double initial_value)
+      : data_(new double[size])
+      , size_(size)
+    {
+        double base_value = double(initial_value * size);
+        for (std::size_t i = 0; i != size; ++i)
+            data_[i] = base_value + double(i);
+    }
+
+    partition_data(partition_data&& other) noexcept
+      : data_(std::move(other.data_))
+      , size_(other.size_)
+    {
+    }
+
+    double& operator[](std::size_t idx)
+    {
+        return data_[idx];
+    }
+    double operator[](std::size_t idx) const
+    {
+        return data_[idx];
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    std::unique_ptr<double[]> data_;
+    std::size_t size_;
+};
+
+std::ostream& operator<<(std::ostream& os, partition_data const& c)
+{
+    os << "{";
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        if (i != 0)
+            os << ", ";
+        os << c[i];
+    }
+    os << "}";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct stepper
+{
+    // Our data for one time step
+    typedef std::vector<partition_data> space;
+
+    // Our operator
+    static double heat(double left, double middle, double right)
+    {
+        return middle + (k * dt / (dx * dx)) * (left - 2 * middle + right);
+    }
+
+    // The partitioned operator, it invokes the heat operator above on all
+    // elements of a partition.
+    static void heat_part(partition_data const& left,
+        partition_data const& middle, partition_data const& right,
+        partition_data& next)
+    {
+        std::size_t size = middle.size();
+
+        next[0] = heat(left[size - 1], middle[0], middle[1]);
+
+        for (std::size_t i = 1; i != size - 1; ++i)
+        {
+            next[i] = heat(middle[i - 1], middle[i], middle[i + 1]);
+        }
+
+        next[size - 1] = heat(middle[size - 2], middle[size - 1], right[0]);
+    }
+
+    // Capture 'nt' time steps on 'np' partitions, starting from U[0]. A
+    // partition of time step t + 1 overwrites the buffer of time step t - 1,
+    // all partitions reading that buffer are its predecessors.
+    void capture(hpx::lcos::local::task_graph& graph, std::size_t np,
+        std::size_t nt)
+    {
+        typedef hpx::lcos::local::task_graph::node_type node_type;
+
+        std::vector<node_type> current, next(np);
+        for (std::size_t t = 0; t != nt; ++t)
+        {
+            space const& u = U[t % 2];
+            space& v = U[(t + 1) % 2];
+
+            for (std::size_t i = 0; i != np; ++i)
+            {
+                auto op = [&u, &v, i, np]() {
+                    heat_part(u[idx(i, -1, np)], u[i], u[idx(i, +1, np)],
+                        v[i]);
+                };
+
+                if (t == 0)
+                {
+                    next[i] = graph.async(op);
+                }
+                else
+                {
+                    next[i] = graph.dataflow(op,
+                        {current[idx(i, -1, np)], current[i],
+                            current[idx(i, +1, np)]});
+                }
+            }
+            std::swap(current, next);
+            next.resize(np);
+        }
+    }
+
+    // do all the work on 'np' partitions, 'nx' data points each, for 'nt'
+    // time steps, capture 'nd' time steps in one task graph
+    space const& do_work(
+        std::size_t np, std::size_t nx, std::size_t nt, std::uint64_t nd)
+    {
+        // U[t][i] is the state of position i at time t.
+        for (space& s : U)
+        {
+            s.clear();
+            s.reserve(np);
+        }
+
+        // Initial conditions: f(0, i) = i
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            U[0].emplace_back(nx, double(i));
+            U[1].emplace_back(nx);
+        }
+
+        // Every replay of the graph starts from U[0] again, this requires
+        // an even number of captured time steps.
+        hpx::lcos::local::task_graph graph;
+        capture(graph, np, nd);
+
+        for (std::size_t t = 0; t != nt / nd; ++t)
+            graph.run().get();
+
+        // Compute the remaining time steps, if any.
+        if (nt % nd != 0)
+        {
+            hpx::lcos::local::task_graph rest;
+            capture(rest, np, nt % nd);
+            rest.run().get();
+        }
+
+        // Return the solution at time-step 'nt'.
+        return U[nt % 2];
+    }
+
+    space U[2];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t np = vm["np"].as<std::uint64_t>();    // Number of partitions.
+    std::uint64_t nx =
+        vm["nx"].as<std::uint64_t>();    // Number of grid points.
+    std::uint64_t nt = vm["nt"].as<std::uint64_t>();    // Number of steps.
+    std::uint64_t nd =
+        vm["nd"].as<std::uint64_t>();    // Time steps per task graph.
+
+    if (vm.count("no-header"))
+        header = false;
+
+    if (nd == 0 || nd % 2 != 0)
+    {
+        std::cerr << "nd must be a positive even number" << std::endl;
+        return hpx::finalize();
+    }
+
+    // Create the stepper object
+    stepper step;
+
+    // Measure execution time.
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+    // Execute nt time steps on nx grid points and print the final solution.
+    stepper::space const& solution = step.do_work(np, nx, nt, nd);
+
+    std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+    // Print the final solution
+    if (vm.count("results"))
+    {
+        for (std::size_t i = 0; i != np; ++i)
+            std::cout << "U[" << i << "] = " << solution[i] << std::endl;
+    }
+
+    std::uint64_t const os_thread_count = hpx::get_os_thread_count();
+    print_time_results(os_thread_count, elapsed, nx, np, nt, header);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    // Configure application-specific options.
+    options_description desc_commandline;
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("results", "print generated results (default: false)")
+        ("nx", value<std::uint64_t>()->default_value(10),
+         "Local x dimension (of each partition)")
+        ("nt", value<std::uint64_t>()->default_value(45),
+         "Number of time steps")
+        ("nd", value<std::uint64_t>()->default_value(10),
+         "Number of time steps captured in one task graph (must be even)")
+        ("np", value<std::uint64_t>()->default_value(10),
+         "Number of partitions")
+        ("k", value<double>(&k)->default_value(0.5),
+         "Heat transfer coefficient (default: 0.5)")
+        ("dt", value<double>(&dt)->default_value(1.0),
+         "Timestep unit (default: 1.0[s])")
+        ("dx", value<double>(&dx)->default_value(1.0),
+         "Local x dimension")
+        ( "no-header", "do not print out the csv header row")
+    ;
+    // clang-format on
+
+    // Initialize and run HPX
+    return hpx::init(desc_commandline, argc, argv);
+}
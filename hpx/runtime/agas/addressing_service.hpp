@@ -29,6 +29,7 @@
 #include <hpx/runtime/agas/symbol_namespace.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <boost/dynamic_bitset.hpp>
@@ -102,6 +103,30 @@ public:
 
     std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+    // {{{ incref batching
+    struct incref_requests_type;
+
+    std::size_t const max_incref_requests_;
+    std::int64_t const incref_flush_delay_;
+
+    std::shared_ptr<incref_requests_type> incref_requests_;
+    std::atomic<std::int64_t> incref_requests_count_;
+
+    // protected by refcnt_requests_mtx_, disabled during shutdown
+    bool enable_incref_staging_;
+
+    // number of threads currently staging increfs or running a scheduled
+    // flush, all of those have to finish before shutting down
+    std::atomic<std::int64_t> incref_staging_operations_;
+    // }}}
+
+    std::atomic<std::int64_t> refcnt_batches_sent_;
+    std::atomic<std::int64_t> refcnt_credits_coalesced_;
+
+    // distribution of the time needed to resolve a gid through AGAS (one
+    // slot per worker thread and one for all other threads)
+    util::log_linear_histogram resolve_time_histogram_;
+
     service_mode const service_type;
     runtime_mode const runtime_type;
 
@@ -286,6 +311,23 @@ private:
       , error_code& ec
         );
 
+    /// Stage an incref request, it will be sent to AGAS together with all
+    /// other increfs staged for the same destination.
+    lcos::future<std::int64_t> stage_incref_request(
+        naming::gid_type const& gid
+      , std::int64_t credits
+        );
+
+    /// Send all staged incref requests, one request per destination.
+    std::vector<hpx::future<void> > send_incref_requests();
+
+    /// Schedule an (optionally delayed) flush of the staged increfs.
+    void schedule_incref_requests_flush();
+
+    // Helper functions to access the reference counting statistics
+    std::uint64_t get_refcnt_batches_sent(bool reset);
+    std::uint64_t get_refcnt_credits_coalesced(bool reset);
+
     // Helper functions to access the current cache statistics
     std::uint64_t get_cache_entries(bool);
     std::uint64_t get_cache_hits(bool);
@@ -303,6 +345,10 @@ private:
     std::uint64_t get_cache_update_entry_time(bool reset);
     std::uint64_t get_cache_erase_entry_time(bool reset);
 
+    // Helper functions to access the AGAS resolve time statistics
+    void record_resolve_time(std::uint64_t start);
+    std::int64_t get_resolve_time_percentile(double percentile, bool reset);
+
 public:
     /// \brief Add a locality to the runtime.
     bool register_locality(
@@ -0,0 +1,168 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The outbound parcels waiting to be sent to one destination. Any number
+    // of threads may enqueue and dequeue parcels concurrently without taking
+    // a lock. Queues are never destroyed before their parcelport.
+    class HPX_EXPORT parcel_queue
+    {
+    private:
+        struct entry
+        {
+            entry() = default;
+
+            entry(parcel&& p, write_handler_type&& f) noexcept
+              : parcel_(std::move(p))
+              , handler_(std::move(f))
+            {
+            }
+
+            // the queue copies elements unless moving them can't throw
+            entry(entry&& rhs) noexcept
+              : parcel_(std::move(rhs.parcel_))
+              , handler_(std::move(rhs.handler_))
+            {
+            }
+
+            entry& operator=(entry&& rhs) noexcept
+            {
+                parcel_ = std::move(rhs.parcel_);
+                handler_ = std::move(rhs.handler_);
+                return *this;
+            }
+
+            parcel parcel_;
+            write_handler_type handler_;
+        };
+
+    public:
+        explicit parcel_queue(locality const& dest);
+
+        parcel_queue(parcel_queue const&) = delete;
+        parcel_queue& operator=(parcel_queue const&) = delete;
+
+        locality const& destination() const
+        {
+            return dest_;
+        }
+
+        void enqueue(parcel&& p, write_handler_type&& f);
+        void enqueue(std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers);
+
+        // Remove all parcels currently queued (at most max_parcels), returns
+        // false if the queue was empty.
+        bool dequeue(std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers,
+            std::size_t max_parcels = std::size_t(-1));
+
+        // The (approximate) number of queued parcels
+        std::size_t size() const
+        {
+            return queue_.size_approx();
+        }
+
+    private:
+        friend class parcel_destination_table;
+
+        locality dest_;
+        hpx::concurrency::ConcurrentQueue<entry> queue_;
+
+        // all queues of a table form a list which is only ever prepended to
+        parcel_queue* next_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps destination localities to their outbound parcel queue. Looking up
+    // the queue of a known destination does not acquire any lock, the queues
+    // are found by the id of the destination locality. A lock is taken only
+    // when a destination is seen for the first time.
+    class HPX_EXPORT parcel_destination_table
+    {
+    public:
+        parcel_destination_table();
+        ~parcel_destination_table();
+
+        parcel_destination_table(parcel_destination_table const&) = delete;
+        parcel_destination_table& operator=(
+            parcel_destination_table const&) = delete;
+
+        // Return the queue for the given destination, creating it if needed.
+        // The locality id is used to find the queue quickly, it may be
+        // naming::invalid_locality_id (during bootstrap).
+        parcel_queue& get(locality const& dest, std::uint32_t locality_id);
+
+        // Call f for every queue which has pending parcels
+        template <typename F>
+        void for_each_pending(F&& f) const
+        {
+            for (parcel_queue* q = queues_.load(std::memory_order_acquire);
+                 q != nullptr; q = q->next_)
+            {
+                if (q->size() != 0)
+                    f(*q);
+            }
+        }
+
+        // The overall number of pending parcels
+        std::int64_t get_pending_parcels_count() const;
+
+    private:
+        parcel_queue& get_slow(locality const& dest, std::uint32_t locality_id);
+
+        // the queues indexed by destination locality id
+        struct index
+        {
+            explicit index(std::size_t size);
+
+            std::size_t size_;
+            std::unique_ptr<std::atomic<parcel_queue*>[]> slots_;
+        };
+
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        std::atomic<index*> index_;
+        std::atomic<parcel_queue*> queues_;
+
+        // protects the members below, taken only when adding destinations
+        mutable mutex_type mtx_;
+        std::map<locality, std::unique_ptr<parcel_queue>> by_locality_;
+
+        // index arrays are never freed before the table as concurrent
+        // readers might still access them
+        std::vector<std::unique_ptr<index>> indices_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -311,6 +311,13 @@ namespace hpx { namespace parcelset
         std::int64_t get_receiving_time(
             std::string const& pp_type, bool reset) const;
 
+        // the time it took for a send (receive) at the given percentile
+        // (nanoseconds)
+        std::int64_t get_sending_time_percentile(std::string const& pp_type,
+            double percentile, bool reset) const;
+        std::int64_t get_receiving_time_percentile(std::string const& pp_type,
+            double percentile, bool reset) const;
+
         // the total time it took for all sender-side serialization operations
         // (nanoseconds)
         std::int64_t get_sending_serialization_time(
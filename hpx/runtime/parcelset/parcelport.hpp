@@ -21,9 +21,11 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_destination_table.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
@@ -224,6 +226,15 @@ namespace hpx { namespace parcelset
         /// completion handler (nanoseconds)
         std::int64_t get_receiving_time(bool reset);
 
+        /// the time it took for a send, from async_write to the completion
+        /// handler, at the given percentile (nanoseconds)
+        std::int64_t get_sending_time_percentile(double percentile, bool reset);
+
+        /// the time it took for a receive, from async_read to the completion
+        /// handler, at the given percentile (nanoseconds)
+        std::int64_t get_receiving_time_percentile(
+            double percentile, bool reset);
+
         /// the total time it took for all sender-side serialization operations
         /// (nanoseconds)
         std::int64_t get_sending_serialization_time(bool reset);
@@ -337,17 +348,8 @@ namespace hpx { namespace parcelset
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
-        typedef hpx::tuple<
-            std::vector<parcel>
-          , std::vector<write_handler_type>
-        > map_second_type;
-        typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
-
-        typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
-        std::atomic<std::uint32_t> num_parcel_destinations_;
+        /// The queues of pending parcels, one for each destination
+        detail::parcel_destination_table parcel_destinations_;
 
         /// The local locality
         locality here_;
@@ -360,6 +362,11 @@ namespace hpx { namespace parcelset
         performance_counters::parcels::gatherer parcels_sent_;
         performance_counters::parcels::gatherer parcels_received_;
 
+        /// Distribution of the send and receive times (one slot per worker
+        /// thread and one for all other threads)
+        util::log_linear_histogram sending_time_histogram_;
+        util::log_linear_histogram receiving_time_histogram_;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // Per-action based parcel statistics
         detail::per_action_data_counter action_parcels_sent_;
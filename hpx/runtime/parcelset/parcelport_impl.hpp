@@ -18,6 +18,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/deferred_call.hpp>
+#include <hpx/naming_base/naming_base.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime/parcelset/detail/call_for_each.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_await.hpp>
@@ -230,9 +231,11 @@ namespace hpx { namespace parcelset
                     else
                     {
                         // enqueue the outgoing parcel ...
-                        enqueue_parcel(dest, std::move(p), std::move(f));
+                        detail::parcel_queue& queue = parcel_destinations_.get(
+                            dest, p.destination_locality_id());
+                        queue.enqueue(std::move(p), std::move(f));
 
-                        get_connection_and_send_parcels(dest);
+                        get_connection_and_send_parcels(queue);
                     }
                 });
         }
@@ -275,10 +278,11 @@ namespace hpx { namespace parcelset
                     }
                     else
                     {
-                        enqueue_parcels(
-                            dest, std::move(parcels), std::move(handlers));
+                        detail::parcel_queue& queue =
+                            get_queue(dest, parcels);
+                        queue.enqueue(std::move(parcels), std::move(handlers));
 
-                        get_connection_and_send_parcels(dest);
+                        get_connection_and_send_parcels(queue);
                     }
                 });
         }
@@ -495,7 +499,8 @@ namespace hpx { namespace parcelset
         >::type
         send_immediate_impl(
             parcelport_impl &this_, locality const&dest_,
-            write_handler_type *fs, parcel *ps, std::size_t num_parcels)
+            write_handler_type *fs, parcel *ps, std::size_t num_parcels,
+            detail::parcel_queue* queue = nullptr)
         {
             std::uint64_t addr;
             error_code ec;
@@ -512,8 +517,9 @@ namespace hpx { namespace parcelset
                 {
                     HPX_ASSERT(ps == nullptr);
                     HPX_ASSERT(num_parcels == 0u);
+                    HPX_ASSERT(queue != nullptr);
 
-                    if(!dequeue_parcels(dest_, parcels, handlers))
+                    if(!queue->dequeue(parcels, handlers))
                     {
                         // Give this connection back to the connection handler as
                         // we couldn't dequeue parcels.
@@ -560,7 +566,9 @@ namespace hpx { namespace parcelset
                 std::vector<write_handler_type> overflow_handlers(
                     std::make_move_iterator(fs + encoded_parcels),
                     std::make_move_iterator(fs + num_parcels));
-                enqueue_parcels(dest_, std::move(overflow_parcels),
+                if (queue == nullptr)
+                    queue = &this_.get_queue(dest_, overflow_parcels);
+                queue->enqueue(std::move(overflow_parcels),
                     std::move(overflow_handlers));
             }
         }
@@ -574,7 +582,8 @@ namespace hpx { namespace parcelset
         >::type
         send_immediate_impl(
             parcelport_impl &this_, locality const&dest_,
-            write_handler_type *fs, parcel *ps, std::size_t num_parcels)
+            write_handler_type *fs, parcel *ps, std::size_t num_parcels,
+            detail::parcel_queue* queue = nullptr)
         {
             HPX_ASSERT(false);
         }
@@ -616,168 +625,24 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(locality const& locality_id,
-            parcel&& p, write_handler_type&& f)
+        detail::parcel_queue& get_queue(
+            locality const& dest, std::vector<parcel> const& parcels)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
-            mapped_type& e = pending_parcels_[locality_id];
-            hpx::get<0>(e).push_back(std::move(p));
-            hpx::get<1>(e).push_back(std::move(f));
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
-        }
-
-        void enqueue_parcels(locality const& locality_id,
-            std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
-        {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
-
-            HPX_ASSERT(parcels.size() == handlers.size());
-
-            mapped_type& e = pending_parcels_[locality_id];
-            if (hpx::get<0>(e).empty())
-            {
-                HPX_ASSERT(hpx::get<1>(e).empty());
-                std::swap(hpx::get<0>(e), parcels);
-                std::swap(hpx::get<1>(e), handlers);
-            }
-            else
-            {
-                HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
-                std::size_t new_size = hpx::get<0>(e).size() + parcels.size();
-                hpx::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(hpx::get<0>(e)));
-                hpx::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(hpx::get<1>(e)));
-            }
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
-        }
-
-        bool dequeue_parcels(locality const& locality_id,
-            std::vector<parcel>& parcels,
-            std::vector<write_handler_type>& handlers)
-        {
-            using iterator = pending_parcels_map::iterator;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-
-                if (!l) return false;
-
-                iterator it = pending_parcels_.find(locality_id);
-
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() && !hpx::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, hpx::get<0>(it->second));
-                    HPX_ASSERT(hpx::get<0>(it->second).size() == 0);
-                    std::swap(handlers, hpx::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(hpx::get<1>(it->second).empty());
-                    return false;
-                }
-
-                parcel_destinations_.erase(locality_id);
-
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
-
-                return true;
-            }
+            // all parcels of a batch are sent to the same locality
+            return parcel_destinations_.get(dest, parcels.empty() ?
+                    naming::invalid_locality_id :
+                    parcels[0].destination_locality_id());
         }
 
     protected:
-        bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
-        {
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-
-                if (!l) return false;
-
-                for (auto &pending: pending_parcels_)
-                {
-                    auto &parcels = hpx::get<0>(pending.second);
-                    if (!parcels.empty())
-                    {
-                        auto& handlers = hpx::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
-                        {
-                            pending_parcels_.erase(dest);
-                        }
-                        return true;
-                    }
-                }
-            }
-            return false;
-        }
-
         bool trigger_pending_work()
         {
-            if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
-                return true;
-
-            std::vector<locality> destinations;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-                if(l.owns_lock())
-                {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
-                    {
-                        destinations.push_back(loc);
-                    }
-                }
-            }
-
             // Create new HPX threads which send the parcels that are still
             // pending.
-            for (locality const& loc : destinations)
-            {
-                get_connection_and_send_parcels(loc);
-            }
+            parcel_destinations_.for_each_pending(
+                [this](detail::parcel_queue& queue) {
+                    get_connection_and_send_parcels(queue);
+                });
 
             return true;
         }
@@ -785,14 +650,15 @@ namespace hpx { namespace parcelset
     private:
         ///////////////////////////////////////////////////////////////////////
         void get_connection_and_send_parcels(
-            locality const& locality_id, bool background = false)
+            detail::parcel_queue& queue, bool background = false)
         {
+            locality const& locality_id = queue.destination();
 
             if (connection_handler_traits<ConnectionHandler>::
                     send_immediate_parcels::value)
             {
                 this->send_immediate_impl<ConnectionHandler>(
-                    *this, locality_id, nullptr, nullptr, 0);
+                    *this, locality_id, nullptr, nullptr, 0, &queue);
                 return;
             }
 
@@ -817,7 +683,7 @@ namespace hpx { namespace parcelset
             std::vector<parcel> parcels;
             std::vector<write_handler_type> handlers;
 
-            if(!dequeue_parcels(locality_id, parcels, handlers))
+            if(!queue.dequeue(parcels, handlers))
             {
                 // Give this connection back to the cache as we couldn't dequeue
                 // parcels.
@@ -828,7 +694,7 @@ namespace hpx { namespace parcelset
 
             // send parcels if they didn't get sent by another connection
             send_pending_parcels(
-                locality_id,
+                queue,
                 sender_connection, std::move(parcels),
                 std::move(handlers));
 
@@ -840,6 +706,7 @@ namespace hpx { namespace parcelset
 
 
         void send_pending_parcels_trampoline(
+            detail::parcel_queue* queue,
             std::error_code const& ec,
             locality const& locality_id,
             std::shared_ptr<connection> sender_connection)
@@ -861,22 +728,17 @@ namespace hpx { namespace parcelset
                 // remove this connection from cache
                 connection_cache_.clear(locality_id, sender_connection);
             }
-            {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
 
-//                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || hpx::get<0>(it->second).empty())
-                    return;
-            }
+            if (queue->size() == 0)
+                return;
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(*queue);
         }
 
         void send_pending_parcels(
-            parcelset::locality const & parcel_locality_id,
+            detail::parcel_queue& queue,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
@@ -888,7 +750,7 @@ namespace hpx { namespace parcelset
 #if defined(HPX_DEBUG)
             // verify the connection points to the right destination
 //            HPX_ASSERT(parcel_locality_id == sender_connection->destination());
-            sender_connection->verify_(parcel_locality_id);
+            sender_connection->verify_(queue.destination());
 #endif
             // encode the parcels
             std::size_t num_parcels = encode_parcels(*this, &parcels[0],
@@ -904,7 +766,7 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, &queue));
             }
             else
             {
@@ -929,14 +791,13 @@ namespace hpx { namespace parcelset
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, &queue));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
-                enqueue_parcels(parcel_locality_id, std::move(parcels),
-                    std::move(handlers));
+                queue.enqueue(std::move(parcels), std::move(handlers));
             }
 
             hpx::execution_base::this_thread::yield();
@@ -0,0 +1,154 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads {
+    /// Parameters controlling the elasticity_controller
+    struct elasticity_parameters
+    {
+        /// The time between two evaluations of the load of the pools
+        std::chrono::milliseconds interval = std::chrono::milliseconds(10);
+
+        /// A pool is considered busy if the number of queued threads per
+        /// active processing unit exceeds this value
+        double busy_queue_length = 1.0;
+
+        /// A pool is considered idle if no threads are queued and its idle
+        /// rate (in percent, background work is not counted as idle time)
+        /// is at least this value
+        double idle_rate = 90.0;
+
+        /// The number of consecutive evaluations a pool has to be busy (or
+        /// idle) before a processing unit is added to (or removed from) it
+        std::size_t hysteresis = 3;
+
+        /// The number of processing units which are always kept active in
+        /// each pool
+        std::size_t min_active_pus = 1;
+    };
+
+    /// The elasticity_controller adjusts the number of active processing units
+    /// of a set of thread pools to their load. It periodically samples the
+    /// queue length and the idle rate of each pool. Processing units of pools
+    /// which stay idle are suspended. Pools which stay busy get a processing
+    /// unit resumed, either one of their own or one lent by another pool.
+    ///
+    /// Processing units are lent between pools which were created on the
+    /// same processing units (this requires the resource partitioner to run
+    /// with resource::mode_allow_oversubscription). Out of the worker threads
+    /// of all managed pools running on the same processing unit, at most one
+    /// is active at any time. Lending a processing unit suspends the worker
+    /// thread of the lending pool and resumes the worker thread of the
+    /// borrowing pool.
+    ///
+    /// All managed pools must have threads::policies::enable_elasticity set.
+    class HPX_EXPORT elasticity_controller
+    {
+    public:
+        /// Create a controller for the pools with the given names. The pools
+        /// are not modified before start() is called.
+        explicit elasticity_controller(std::vector<std::string> const& pools,
+            elasticity_parameters const& params = elasticity_parameters());
+
+        /// Stops the controller (see stop())
+        ~elasticity_controller();
+
+        elasticity_controller(elasticity_controller const&) = delete;
+        elasticity_controller& operator=(elasticity_controller const&) = delete;
+
+        /// Start adjusting the pools on a dedicated OS thread. Worker threads
+        /// sharing a processing unit with a worker thread of a pool given
+        /// earlier are suspended.
+        void start(error_code& ec = throws);
+
+        /// Stop adjusting the pools and resume all processing units which
+        /// were suspended by the controller.
+        void stop(error_code& ec = throws);
+
+        /// Returns whether the controller is adjusting the pools
+        bool is_running() const;
+
+        /// Evaluate the load of all pools once and adjust the active
+        /// processing units. This is called periodically once the controller
+        /// was started. It must not be called from a thread running on one
+        /// of the managed pools.
+        void evaluate(error_code& ec = throws);
+
+        /// Returns the number of processing units of the given pool which are
+        /// active
+        std::size_t get_num_active_pus(std::string const& pool) const;
+
+        /// Returns the number of processing units lent from one pool to
+        /// another since the controller was created
+        std::size_t get_num_lent_pus() const;
+
+        /// Returns the number of processing units suspended or resumed by the
+        /// controller since it was created
+        std::size_t get_num_suspended_pus() const;
+        std::size_t get_num_resumed_pus() const;
+
+    private:
+        struct worker
+        {
+            std::size_t pool_;
+            std::size_t virt_core_;
+            std::size_t pu_;
+            bool active_;
+        };
+
+        struct managed_pool
+        {
+            thread_pool_base* pool_;
+            std::vector<std::size_t> workers_;
+            std::size_t busy_count_;
+            std::size_t idle_count_;
+        };
+
+        void run();
+
+        std::size_t num_active(managed_pool const& p) const;
+        bool is_pu_free(std::size_t pu) const;
+
+        bool suspend(std::size_t w, error_code& ec);
+        bool resume(std::size_t w, error_code& ec);
+
+        bool shrink(std::size_t p, error_code& ec);
+
+        elasticity_parameters const params_;
+
+        mutable std::mutex mtx_;
+        std::vector<worker> workers_;
+        std::vector<managed_pool> pools_;
+
+        std::size_t num_lent_;
+        std::size_t num_suspended_;
+        std::size_t num_resumed_;
+
+        // the OS thread periodically evaluating the pools
+        std::mutex run_mtx_;
+        std::condition_variable cond_;
+        std::thread thread_;
+        bool stop_;
+    };
+}}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
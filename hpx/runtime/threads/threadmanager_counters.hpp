@@ -45,6 +45,24 @@ namespace hpx { namespace threads {
             performance_counters::counter_info const& info, error_code& ec);
 #endif
 
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+        typedef std::int64_t (threadmanager::*threadmanager_percentile_func)(
+            double percentile, bool reset);
+        typedef std::int64_t (thread_pool_base::*threadpool_percentile_func)(
+            std::size_t num_thread, double percentile, bool reset);
+
+        naming::gid_type locality_pool_thread_percentile_counter_creator(
+            threadmanager* tm, threadmanager_percentile_func total_func,
+            threadpool_percentile_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec);
+#endif
+
+        // locality/pool/worker-thread counter creation function for counters
+        // reporting a per-tenant value (the tenant name is given as the
+        // counter parameter)
+        naming::gid_type tenant_cpu_time_counter_creator(threadmanager* tm,
+            performance_counters::counter_info const& info, error_code& ec);
+
         naming::gid_type locality_pool_thread_no_total_counter_creator(
             threadmanager* tm, threadpool_counter_func pool_func,
             performance_counters::counter_info const& info, error_code& ec);
@@ -0,0 +1,69 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// On-disk layout of the files written by the binary performance counter
+// sample sink (--hpx:print-counter-format=binary). This header is
+// intentionally self-contained so that offline tools can read the files
+// without depending on HPX.
+//
+// A file consists of three regions:
+//
+//   [header][names][columns]
+//
+// - header:  a counter_sample_file_header structure
+// - names:   for each counter its full name and its unit of measure, each
+//            terminated by a '\0'
+// - columns: 1 + num_counters_ columns of capacity_ 8-byte entries each.
+//            Column 0 holds the sample timestamps (std::int64_t, nanoseconds
+//            since the start of the runtime), column 1 + i holds the values
+//            of counter i (double, NaN if the counter value was invalid).
+//
+// The columns form a ring: sample number n is stored at index
+// n % capacity_ of each column. The header member samples_ holds the number
+// of samples written in total, the valid samples are therefore
+// [max(0, samples_ - capacity_), samples_). All values are stored in the
+// native byte order of the writing machine.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr char const counter_sample_file_magic[8] = {
+        'H', 'P', 'X', 'C', 'S', 'M', 'P', '\0'};
+    constexpr std::uint32_t counter_sample_file_version = 1;
+
+    // size of a single column entry
+    constexpr std::size_t counter_sample_entry_size = 8;
+
+    struct counter_sample_file_header
+    {
+        char magic_[8];
+        std::uint32_t version_;
+        std::uint32_t num_counters_;
+        std::uint64_t capacity_;         // number of samples in the ring
+        std::uint64_t names_offset_;     // file offset of the names region
+        std::uint64_t names_size_;       // size of the names region
+        std::uint64_t columns_offset_;   // file offset of the first column
+        std::uint64_t samples_;          // number of samples written
+        std::uint64_t dropped_samples_;  // samples the writer could not keep up with
+        std::uint32_t locality_id_;
+        std::uint32_t reserved_;
+    };
+
+    // file offset of the entry for the given column and sample number
+    constexpr std::uint64_t counter_sample_entry_offset(
+        counter_sample_file_header const& header, std::uint64_t column,
+        std::uint64_t sample)
+    {
+        return header.columns_offset_ +
+            (column * header.capacity_ + sample % header.capacity_) *
+            counter_sample_entry_size;
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,81 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/util/counter_sample_format.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The counter_sample_sink writes performance counter samples in a
+    /// binary, columnar format to a memory mapped ring file (see
+    /// hpx/util/counter_sample_format.hpp for the layout).
+    ///
+    /// Samples are copied into a small set of preallocated staging rows by
+    /// the caller and written to the file by a dedicated OS thread, which
+    /// keeps any file I/O off the HPX worker threads. If the writer falls
+    /// behind, samples are dropped and accounted for in the file header.
+    class HPX_EXPORT counter_sample_sink
+    {
+    public:
+        HPX_NON_COPYABLE(counter_sample_sink);
+
+    public:
+        counter_sample_sink(std::string const& filename,
+            std::vector<std::string> const& names,
+            std::vector<std::string> const& units, std::size_t capacity,
+            std::uint32_t locality_id);
+        ~counter_sample_sink();
+
+        // Stage one sample, values has to hold one value per counter. This
+        // never blocks on file I/O.
+        void push(std::int64_t timestamp, std::vector<double> const& values);
+
+        // Wait for all staged samples to be written and stop the writer.
+        void stop();
+
+        std::uint64_t dropped_samples() const;
+
+    private:
+        void run();
+        void write_sample(std::size_t row);
+
+        std::size_t const num_counters_;
+        std::size_t const staging_rows_;
+
+        int fd_;
+        void* data_;
+        std::size_t size_;
+        counter_sample_file_header* header_;
+
+        // staging area, protected by mtx_
+        mutable std::mutex mtx_;
+        std::condition_variable cond_;
+        std::vector<std::int64_t> staged_timestamps_;
+        std::vector<double> staged_values_;
+        std::uint64_t staged_head_;
+        std::uint64_t staged_tail_;
+        std::uint64_t dropped_;
+        bool stopped_;
+
+        std::thread writer_;
+    };
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
+#endif
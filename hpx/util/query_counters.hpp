@@ -14,12 +14,14 @@
 #include <hpx/performance_counters/performance_counter_set.hpp>
 #include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/synchronization/mutex.hpp>
+#include <hpx/util/counter_sample_sink.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
 #include <map>
 #endif
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -68,6 +70,11 @@ namespace hpx { namespace util {
             std::vector<performance_counters::counter_info> const& infos,
             error_code& ec);
 
+        void create_sample_sink(
+            std::vector<performance_counters::counter_info> const& infos);
+        void push_sample(
+            std::vector<performance_counters::counter_value> const& values);
+
         template <typename Stream>
         void print_headers(Stream& output,
             std::vector<performance_counters::counter_info> const& infos);
@@ -118,6 +125,10 @@ namespace hpx { namespace util {
 
         interval_timer timer_;
 
+        // used for --hpx:print-counter-format=binary only
+        std::unique_ptr<counter_sample_sink> sample_sink_;
+        std::vector<double> sample_values_;
+
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
         std::map<std::string, util::itt::counter> itt_counters_;
 #endif
@@ -177,6 +177,28 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of outstanding incref requests which are staged
+/// before they are sent (aggregated per destination) to AGAS. A value of zero
+/// disables incref batching.
+#if !defined(HPX_INITIAL_AGAS_MAX_PENDING_INCREF_REQUESTS)
+#  define HPX_INITIAL_AGAS_MAX_PENDING_INCREF_REQUESTS 128
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the default number of samples kept in the ring file written
+/// for --hpx:print-counter-format=binary (hpx.print_counter.binary_capacity).
+#if !defined(HPX_INITIAL_COUNTER_SAMPLE_CAPACITY)
+#  define HPX_INITIAL_COUNTER_SAMPLE_CAPACITY 4096
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the default number of events kept for each worker thread by
+/// the task tracer (hpx.task_trace.capacity).
+#if !defined(HPX_INITIAL_TASK_TRACE_CAPACITY)
+#  define HPX_INITIAL_TASK_TRACE_CAPACITY 16384
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
@@ -493,6 +515,20 @@
 #endif
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Continuations launched with hpx::launch::adaptive are executed directly only
+// if the recursion depth of continuations is below this limit and if their
+// measured average execution time is below the given threshold (in
+// nanoseconds).
+#if !defined(HPX_ADAPTIVE_CONTINUATION_MAX_RECURSION_DEPTH)
+#define HPX_ADAPTIVE_CONTINUATION_MAX_RECURSION_DEPTH                          \
+    (HPX_CONTINUATION_MAX_RECURSION_DEPTH / 2)
+#endif
+
+#if !defined(HPX_ADAPTIVE_CONTINUATION_THRESHOLD)
+#define HPX_ADAPTIVE_CONTINUATION_THRESHOLD 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Make sure we have support for more than 64 threads for Xeon Phi
 #if defined(__MIC__) && !defined(HPX_HAVE_MORE_THAN_64_THREADS)
@@ -0,0 +1,61 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+
+namespace hpx { namespace util { namespace logging {
+
+    namespace detail {
+
+        struct named_destinations;
+
+        // Hand a formatted message to the background writer. Returns false
+        // if asynchronous writing is disabled or if the message has to be
+        // written by the caller as the queue is full.
+        HPX_CORE_EXPORT bool async_write(
+            named_destinations const& destinations, std::stringstream& out);
+    }    // namespace detail
+
+    /**
+    @brief Write all log messages from a background thread
+
+    After calling this, log messages are still formatted by the logging
+    thread (the formatters capture the context of the log site) but are then
+    queued without taking any locks. A dedicated OS thread writes them to
+    their destinations.
+
+    @param queue_size the maximum number of messages of each OS thread
+    waiting to be written
+    @param drop_on_overflow if true, messages which don't fit into the queue
+    are discarded, otherwise the logging thread writes them itself
+    */
+    HPX_CORE_EXPORT void enable_async_writing(
+        std::size_t queue_size = 4096, bool drop_on_overflow = true);
+
+    /**
+    @brief Write all queued messages and switch back to writing messages
+    from the logging thread
+    */
+    HPX_CORE_EXPORT void disable_async_writing();
+
+    HPX_CORE_EXPORT bool is_async_writing_enabled() noexcept;
+
+    /**
+    @brief Wait until all currently queued messages have been written
+    */
+    HPX_CORE_EXPORT void flush_async_writing();
+
+    // statistics of the background writer
+    HPX_CORE_EXPORT std::int64_t get_async_written_count(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_async_dropped_count(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_async_overflow_count(bool reset);
+}}}    // namespace hpx::util::logging
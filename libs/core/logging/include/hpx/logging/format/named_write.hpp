@@ -17,6 +17,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/format/async_write.hpp>
 #include <hpx/logging/format/destinations.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
@@ -399,6 +400,11 @@ This will just configure "file" twice, ending up with writing only to "two.txt"
             m_format(out, msg);
 
 #if !defined(HPX_COMPUTE_HOST_CODE)
+            // the destinations are invoked by the background writer, if
+            // enabled
+            if (detail::async_write(m_destination, out))
+                return;
+
             message formatted(std::move(out));
             m_destination(formatted);
 #endif
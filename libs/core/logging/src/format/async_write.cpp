@@ -0,0 +1,340 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/logging/format/async_write.hpp>
+#include <hpx/logging/format/named_write.hpp>
+#include <hpx/logging/message.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util { namespace logging { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct async_record
+    {
+        named_destinations const* destinations = nullptr;
+        std::string text;
+    };
+
+    // Single producer, single consumer ring of formatted messages. Every OS
+    // thread which logs owns one, the background writer drains all of them.
+    class async_ring
+    {
+    public:
+        explicit async_ring(std::size_t size)
+        {
+            std::size_t capacity = 2;
+            while (capacity < size)
+                capacity <<= 1;
+            records_.resize(capacity);
+            mask_ = capacity - 1;
+        }
+
+        bool push(named_destinations const& destinations, std::string&& text)
+        {
+            std::size_t const tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) > mask_)
+                return false;    // full
+
+            async_record& record = records_[tail & mask_];
+            record.destinations = &destinations;
+            record.text = std::move(text);
+
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        template <typename F>
+        std::size_t consume(F&& f)
+        {
+            std::size_t head = head_.load(std::memory_order_relaxed);
+            std::size_t const tail = tail_.load(std::memory_order_acquire);
+            std::size_t const count = tail - head;
+
+            for (/**/; head != tail; ++head)
+            {
+                async_record& record = records_[head & mask_];
+                named_destinations const* destinations = record.destinations;
+                std::string text = std::move(record.text);
+                record.text.clear();
+
+                // release the slot before writing the message, the producer
+                // may refill it right away
+                head_.store(head + 1, std::memory_order_release);
+
+                f(*destinations, std::move(text));
+            }
+            return count;
+        }
+
+        async_ring* next_ = nullptr;
+
+    private:
+        std::vector<async_record> records_;
+        std::size_t mask_ = 0;
+
+        // keep the consumer and producer indices on separate cache lines
+        std::atomic<std::size_t> head_{0};
+        char padding_[64];
+        std::atomic<std::size_t> tail_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    class async_writer
+    {
+    public:
+        async_writer() = default;
+
+        ~async_writer()
+        {
+            stop();
+
+            // write anything that was queued after the thread has stopped
+            drain();
+
+            async_ring* ring = rings_.load(std::memory_order_acquire);
+            while (ring != nullptr)
+            {
+                async_ring* next = ring->next_;
+                delete ring;
+                ring = next;
+            }
+        }
+
+        void start(std::size_t queue_size, bool drop_on_overflow)
+        {
+            std::lock_guard<std::mutex> l(control_mtx_);
+            if (enabled_.load(std::memory_order_relaxed))
+                return;
+
+            queue_size_ = queue_size;
+            drop_on_overflow_ = drop_on_overflow;
+            stop_ = false;
+
+            thread_ = std::thread(&async_writer::run, this);
+            enabled_.store(true, std::memory_order_release);
+        }
+
+        void stop()
+        {
+            std::lock_guard<std::mutex> l(control_mtx_);
+            if (!enabled_.exchange(false, std::memory_order_acq_rel))
+                return;
+
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                stop_ = true;
+            }
+            cond_.notify_all();
+            thread_.join();
+        }
+
+        bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_acquire);
+        }
+
+        bool enqueue(
+            named_destinations const& destinations, std::stringstream& out)
+        {
+            if (!enabled_.load(std::memory_order_acquire))
+                return false;
+
+            if (get_ring().push(destinations, out.str()))
+                return true;
+
+            overflows_.fetch_add(1, std::memory_order_relaxed);
+            if (!drop_on_overflow_)
+                return false;
+
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void flush()
+        {
+            if (!enabled_.load(std::memory_order_acquire))
+                return;
+
+            std::unique_lock<std::mutex> l(mtx_);
+            ++flush_requests_;
+            cond_.notify_all();
+            flushed_cond_.wait(l, [this]() { return flush_requests_ == 0; });
+        }
+
+        std::int64_t written(bool reset)
+        {
+            return get_and_reset(written_, reset);
+        }
+        std::int64_t dropped(bool reset)
+        {
+            return get_and_reset(dropped_, reset);
+        }
+        std::int64_t overflows(bool reset)
+        {
+            return get_and_reset(overflows_, reset);
+        }
+
+    private:
+        static std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset)
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        // return the ring of the calling OS thread, create it on first use
+        async_ring& get_ring()
+        {
+            static thread_local async_ring* ring = nullptr;
+            if (ring == nullptr)
+            {
+                ring = new async_ring(queue_size_);
+
+                async_ring* head = rings_.load(std::memory_order_relaxed);
+                do
+                {
+                    ring->next_ = head;
+                } while (!rings_.compare_exchange_weak(head, ring,
+                    std::memory_order_release, std::memory_order_relaxed));
+            }
+            return *ring;
+        }
+
+        // write all queued messages, returns the number of written messages
+        std::size_t drain()
+        {
+            std::size_t count = 0;
+            for (async_ring* ring = rings_.load(std::memory_order_acquire);
+                 ring != nullptr; ring = ring->next_)
+            {
+                count += ring->consume(
+                    [](named_destinations const& destinations,
+                        std::string&& text) {
+                        std::stringstream out;
+                        out << text;
+                        message msg(std::move(out));
+                        destinations(msg);
+                    });
+            }
+            written_.fetch_add(
+                static_cast<std::int64_t>(count), std::memory_order_relaxed);
+            return count;
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            while (true)
+            {
+                std::size_t requests = flush_requests_;
+                bool stop = stop_;
+
+                std::size_t count = 0;
+                {
+                    l.unlock();
+                    count = drain();
+                    l.lock();
+                }
+
+                // everything that was queued before a flush was requested
+                // has been written now
+                if (requests != 0)
+                {
+                    flush_requests_ -= requests;
+                    flushed_cond_.notify_all();
+                }
+
+                if (stop)
+                    break;
+
+                // producers never signal, poll with a short timeout
+                if (count == 0 && flush_requests_ == 0 && !stop_)
+                    cond_.wait_for(l, std::chrono::milliseconds(1));
+            }
+        }
+
+        std::atomic<bool> enabled_{false};
+        std::size_t queue_size_ = 0;
+        bool drop_on_overflow_ = true;
+
+        std::atomic<async_ring*> rings_{nullptr};
+
+        std::atomic<std::int64_t> written_{0};
+        std::atomic<std::int64_t> dropped_{0};
+        std::atomic<std::int64_t> overflows_{0};
+
+        std::mutex control_mtx_;
+        std::thread thread_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        std::condition_variable flushed_cond_;
+        std::size_t flush_requests_ = 0;
+        bool stop_ = false;
+    };
+
+    async_writer& get_async_writer()
+    {
+        static async_writer writer;
+        return writer;
+    }
+
+    bool async_write(
+        named_destinations const& destinations, std::stringstream& out)
+    {
+        return get_async_writer().enqueue(destinations, out);
+    }
+}}}}    // namespace hpx::util::logging::detail
+
+namespace hpx { namespace util { namespace logging {
+
+    void enable_async_writing(std::size_t queue_size, bool drop_on_overflow)
+    {
+        detail::get_async_writer().start(queue_size, drop_on_overflow);
+    }
+
+    void disable_async_writing()
+    {
+        detail::get_async_writer().stop();
+    }
+
+    bool is_async_writing_enabled() noexcept
+    {
+        return detail::get_async_writer().enabled();
+    }
+
+    void flush_async_writing()
+    {
+        detail::get_async_writer().flush();
+    }
+
+    std::int64_t get_async_written_count(bool reset)
+    {
+        return detail::get_async_writer().written(reset);
+    }
+
+    std::int64_t get_async_dropped_count(bool reset)
+    {
+        return detail::get_async_writer().dropped(reset);
+    }
+
+    std::int64_t get_async_overflow_count(bool reset)
+    {
+        return detail::get_async_writer().overflows(reset);
+    }
+}}}    // namespace hpx::util::logging
@@ -0,0 +1,153 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_HAVE_LOGGING)
+#include <hpx/logging/format/async_write.hpp>
+#include <hpx/logging/manipulator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logging = hpx::util::logging;
+
+///////////////////////////////////////////////////////////////////////////////
+std::mutex mtx;
+std::vector<std::string> messages;
+std::vector<std::thread::id> writers;
+
+std::atomic<bool> entered(false);
+std::atomic<bool> blocked(false);
+
+struct record_destination : logging::destination::manipulator
+{
+    void operator()(logging::message const& msg) override
+    {
+        entered = true;
+        while (blocked)
+            std::this_thread::yield();
+
+        std::lock_guard<std::mutex> l(mtx);
+        messages.push_back(msg.full_string());
+        writers.push_back(std::this_thread::get_id());
+    }
+};
+
+logging::logger& test_logger()
+{
+    static logging::logger l(logging::level::enable_all);
+    return l;
+}
+
+void log(std::size_t i)
+{
+    test_logger().gather() << "message " << i;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async_write()
+{
+    messages.clear();
+    writers.clear();
+
+    logging::enable_async_writing();
+    HPX_TEST(logging::is_async_writing_enabled());
+
+    for (std::size_t i = 0; i != 100; ++i)
+        log(i);
+
+    logging::flush_async_writing();
+
+    std::lock_guard<std::mutex> l(mtx);
+    HPX_TEST_EQ(messages.size(), std::size_t(100));
+    for (std::size_t i = 0; i != messages.size(); ++i)
+    {
+        // messages logged by one thread are written in order
+        HPX_TEST_EQ(messages[i], "message " + std::to_string(i) + "\n");
+        HPX_TEST(writers[i] != std::this_thread::get_id());
+    }
+    HPX_TEST_EQ(logging::get_async_written_count(true), std::int64_t(100));
+
+    logging::disable_async_writing();
+    HPX_TEST(!logging::is_async_writing_enabled());
+}
+
+void test_sync_write()
+{
+    messages.clear();
+    writers.clear();
+
+    log(0);
+
+    std::lock_guard<std::mutex> l(mtx);
+    HPX_TEST_EQ(messages.size(), std::size_t(1));
+    HPX_TEST(writers[0] == std::this_thread::get_id());
+}
+
+void test_overflow()
+{
+    messages.clear();
+    writers.clear();
+
+    logging::get_async_dropped_count(true);
+    logging::get_async_overflow_count(true);
+
+    // the queue of this thread was created with the default size by the
+    // first test, a different size applies to new threads only
+    logging::enable_async_writing(4, true);
+
+    std::thread t([]() {
+        // block the background writer in the first message
+        entered = false;
+        blocked = true;
+        log(0);
+        while (!entered)
+            std::this_thread::yield();
+
+        for (std::size_t i = 1; i != 8; ++i)
+            log(i);
+
+        blocked = false;
+    });
+    t.join();
+
+    logging::flush_async_writing();
+    logging::disable_async_writing();
+
+    std::lock_guard<std::mutex> l(mtx);
+    HPX_TEST_EQ(messages.size(), std::size_t(5));
+    HPX_TEST_EQ(logging::get_async_dropped_count(true), std::int64_t(3));
+    HPX_TEST_EQ(logging::get_async_overflow_count(true), std::int64_t(3));
+}
+
+int main()
+{
+    logging::writer::named_write& writer = test_logger().writer();
+    writer.set_destination("record", record_destination());
+    writer.write("|\n", "record");
+    test_logger().mark_as_initialized();
+
+    test_sync_write();
+    test_async_write();
+    test_sync_write();
+    test_overflow();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
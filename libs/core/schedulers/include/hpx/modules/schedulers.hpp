@@ -21,3 +21,9 @@
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #endif
+#if defined(HPX_HAVE_LOCAL_DEADLINE_SCHEDULER)
+#include <hpx/schedulers/local_deadline_queue_scheduler.hpp>
+#endif
+#if defined(HPX_HAVE_FAIR_SHARE_SCHEDULER)
+#include <hpx/schedulers/local_fair_share_queue_scheduler.hpp>
+#endif
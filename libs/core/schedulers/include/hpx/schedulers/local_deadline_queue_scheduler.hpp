@@ -0,0 +1,459 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCAL_DEADLINE_SCHEDULER)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_local_deadline_queue_scheduler_terminated_queue =
+        lockfree_lifo;
+#else
+    using default_local_deadline_queue_scheduler_terminated_queue =
+        lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_deadline_queue_scheduler is a local_priority_queue_scheduler
+    /// which additionally maintains one queue per OS thread holding all
+    /// threads which were created with an absolute deadline (see
+    /// thread_init_data::deadline). These queues are ordered by deadline
+    /// (earliest deadline first). Whenever an OS thread looks for work it
+    /// runs the thread with the earliest deadline (looking at the queues of
+    /// the other OS threads if stealing is enabled) before falling back to
+    /// the normal priority based scheduling, i.e. threads without a deadline
+    /// are treated as if their deadline was infinitely far away.
+    ///
+    /// The scheduler counts the threads which finished after their deadline
+    /// and the time by which they missed their deadline.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_deadline_queue_scheduler_terminated_queue>
+    class HPX_CORE_EXPORT local_deadline_queue_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+    protected:
+        static constexpr std::uint64_t no_deadline = std::uint64_t(-1);
+
+        struct deadline_entry
+        {
+            std::uint64_t deadline_;
+            threads::thread_data* thrd_;
+
+            // std::push_heap/pop_heap build a max-heap, order the entries
+            // such that the earliest deadline is at the front
+            friend bool operator<(
+                deadline_entry const& lhs, deadline_entry const& rhs) noexcept
+            {
+                return lhs.deadline_ > rhs.deadline_;
+            }
+        };
+
+        struct deadline_queue
+        {
+            deadline_queue()
+              : earliest_(no_deadline)
+              , count_(0)
+              , missed_deadlines_(0)
+              , late_threads_(0)
+              , cumulative_lateness_(0)
+            {
+            }
+
+            Mutex mtx_;
+            std::vector<deadline_entry> heap_;
+
+            // the earliest deadline in this queue (no_deadline if empty),
+            // this allows to find the queue to pick from without locking
+            std::atomic<std::uint64_t> earliest_;
+            std::atomic<std::int64_t> count_;
+
+            // statistics of the threads which were run by the owning OS
+            // thread, the average lateness is reset independently of the
+            // number of missed deadlines
+            std::atomic<std::int64_t> missed_deadlines_;
+            std::atomic<std::int64_t> late_threads_;
+            std::atomic<std::int64_t> cumulative_lateness_;
+        };
+
+    public:
+        local_deadline_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , num_deadline_threads_(0)
+          , deadline_queues_(init.num_queues_)
+        {
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_deadline_queue_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(
+            thread_init_data& data, thread_id_type* id, error_code& ec) override
+        {
+            if (data.deadline == 0)
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            // Create the thread object right away, but don't put it into the
+            // queues of the base scheduler. The base scheduler selects the
+            // OS thread the new thread should be associated with.
+            thread_state_enum const initial_state = data.initial_state;
+
+            data.run_now = true;
+            data.initial_state = pending_do_not_schedule;
+
+            thread_id_type thrd;
+            base_type::create_thread(data, &thrd, ec);
+            if (!thrd)
+                return;
+
+            if (initial_state == pending || initial_state == pending_boost)
+            {
+                HPX_ASSERT(
+                    data.schedulehint.mode == thread_schedule_hint_mode_thread);
+                push_deadline_thread(get_thread_id_data(thrd),
+                    static_cast<std::size_t>(data.schedulehint.hint));
+            }
+
+            if (id)
+                *id = thrd;
+        }
+
+        void create_threads_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            // threads with a deadline are created one by one
+            if (std::any_of(data, data + count,
+                    [](thread_init_data const& d) { return d.deadline != 0; }))
+            {
+                scheduler_base::create_threads_bulk(data, count, ec);
+                return;
+            }
+            base_type::create_threads_bulk(data, count, ec);
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_data*& thrd, bool enable_stealing) override
+        {
+            if (num_deadline_threads_.load(std::memory_order_relaxed) != 0 &&
+                pop_deadline_thread(
+                    num_thread, thrd, running && enable_stealing))
+            {
+                return true;
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_data* thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority_normal) override
+        {
+            if (thrd->get_deadline() == 0)
+            {
+                base_type::schedule_thread(
+                    thrd, schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            push_deadline_thread(
+                thrd, select_queue(schedulehint, allow_fallback));
+        }
+
+        void schedule_thread_last(threads::thread_data* thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority_normal) override
+        {
+            if (thrd->get_deadline() == 0)
+            {
+                base_type::schedule_thread_last(
+                    thrd, schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            // the deadline determines the position in the queue
+            push_deadline_thread(
+                thrd, select_queue(schedulehint, allow_fallback));
+        }
+
+        /// Destroy the passed thread as it has been terminated
+        void destroy_thread(threads::thread_data* thrd) override
+        {
+            std::uint64_t const deadline = thrd->get_deadline();
+            if (deadline != 0)
+            {
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                if (now > deadline)
+                {
+                    // threads are destroyed by the OS thread which ran them
+                    std::size_t num_thread =
+                        hpx::get_local_worker_thread_num();
+                    if (num_thread >= this->num_queues_)
+                        num_thread %= this->num_queues_;
+
+                    deadline_queue& q = deadline_queues_[num_thread].data_;
+                    ++q.missed_deadlines_;
+                    ++q.late_threads_;
+                    q.cumulative_lateness_ +=
+                        static_cast<std::int64_t>(now - deadline);
+                }
+            }
+
+            base_type::destroy_thread(thrd);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues (work items and new
+        // items)
+        std::int64_t get_queue_length(
+            std::size_t num_thread = std::size_t(-1)) const override
+        {
+            std::int64_t count = base_type::get_queue_length(num_thread);
+
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return count + deadline_queues_[num_thread].data_.count_;
+            }
+
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                count += deadline_queues_[i].data_.count_;
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            if (num_thread < this->num_queues_ &&
+                deadline_queues_[num_thread].data_.count_ != 0)
+            {
+                return false;
+            }
+            return base_type::is_core_idle(num_thread);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_num_missed_deadlines(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return util::get_and_reset_value(
+                    deadline_queues_[num_thread].data_.missed_deadlines_,
+                    reset);
+            }
+
+            std::int64_t num_missed_deadlines = 0;
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                num_missed_deadlines += util::get_and_reset_value(
+                    deadline_queues_[i].data_.missed_deadlines_, reset);
+            }
+            return num_missed_deadlines;
+        }
+
+        // Returns the average time (in nanoseconds) by which the threads
+        // which missed their deadline have finished late
+        std::int64_t get_average_deadline_lateness(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t late_threads = 0;
+            std::int64_t cumulative_lateness = 0;
+
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                deadline_queue& q = deadline_queues_[num_thread].data_;
+                late_threads =
+                    util::get_and_reset_value(q.late_threads_, reset);
+                cumulative_lateness =
+                    util::get_and_reset_value(q.cumulative_lateness_, reset);
+            }
+            else
+            {
+                for (std::size_t i = 0; i != this->num_queues_; ++i)
+                {
+                    deadline_queue& q = deadline_queues_[i].data_;
+                    late_threads +=
+                        util::get_and_reset_value(q.late_threads_, reset);
+                    cumulative_lateness += util::get_and_reset_value(
+                        q.cumulative_lateness_, reset);
+                }
+            }
+
+            return late_threads != 0 ? cumulative_lateness / late_threads : 0;
+        }
+
+    protected:
+        // select the queue a thread should be put into, this follows the
+        // logic of local_priority_queue_scheduler::schedule_thread
+        std::size_t select_queue(
+            threads::thread_schedule_hint schedulehint, bool allow_fallback)
+        {
+            // NOTE: This scheduler ignores NUMA hints.
+            std::size_t num_thread = std::size_t(-1);
+            if (schedulehint.mode == thread_schedule_hint_mode_thread)
+            {
+                num_thread = schedulehint.hint;
+            }
+            else
+            {
+                allow_fallback = false;
+            }
+
+            if (std::size_t(-1) == num_thread)
+            {
+                num_thread = this->curr_queue_++ % this->num_queues_;
+            }
+            else if (num_thread >= this->num_queues_)
+            {
+                num_thread %= this->num_queues_;
+            }
+
+            std::unique_lock<typename base_type::pu_mutex_type> l;
+            return this->select_active_pu(l, num_thread, allow_fallback);
+        }
+
+        void push_deadline_thread(
+            threads::thread_data* thrd, std::size_t num_thread)
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+            HPX_ASSERT(thrd->get_deadline() != 0);
+
+            deadline_queue& q = deadline_queues_[num_thread].data_;
+            {
+                std::lock_guard<Mutex> l(q.mtx_);
+
+                q.heap_.push_back(deadline_entry{thrd->get_deadline(), thrd});
+                std::push_heap(q.heap_.begin(), q.heap_.end());
+
+                q.earliest_.store(
+                    q.heap_.front().deadline_, std::memory_order_relaxed);
+                ++q.count_;
+            }
+            ++num_deadline_threads_;
+        }
+
+        // Pick the thread with the earliest deadline from the queue of the
+        // given OS thread or (if stealing is enabled) from any other queue.
+        bool pop_deadline_thread(std::size_t num_thread,
+            threads::thread_data*& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            // another OS thread might grab the selected thread before we get
+            // to lock the queue, retry a couple of times in that case
+            for (std::size_t attempt = 0; attempt != this->num_queues_;
+                 ++attempt)
+            {
+                std::size_t selected = num_thread;
+                std::uint64_t earliest =
+                    deadline_queues_[num_thread].data_.earliest_.load(
+                        std::memory_order_relaxed);
+
+                if (enable_stealing)
+                {
+                    for (std::size_t i = 0; i != this->num_queues_; ++i)
+                    {
+                        std::uint64_t const e =
+                            deadline_queues_[i].data_.earliest_.load(
+                                std::memory_order_relaxed);
+                        if (e < earliest)
+                        {
+                            earliest = e;
+                            selected = i;
+                        }
+                    }
+                }
+
+                if (earliest == no_deadline)
+                    return false;
+
+                deadline_queue& q = deadline_queues_[selected].data_;
+                std::unique_lock<Mutex> l(q.mtx_, std::try_to_lock);
+                if (!l.owns_lock() || q.heap_.empty())
+                    continue;
+
+                std::pop_heap(q.heap_.begin(), q.heap_.end());
+                thrd = q.heap_.back().thrd_;
+                q.heap_.pop_back();
+
+                q.earliest_.store(
+                    q.heap_.empty() ? no_deadline : q.heap_.front().deadline_,
+                    std::memory_order_relaxed);
+                --q.count_;
+
+                l.unlock();
+
+                --num_deadline_threads_;
+                return true;
+            }
+            return false;
+        }
+
+    protected:
+        // overall number of threads held by the deadline queues
+        std::atomic<std::int64_t> num_deadline_threads_;
+
+        std::vector<util::cache_aligned_data<deadline_queue>> deadline_queues_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
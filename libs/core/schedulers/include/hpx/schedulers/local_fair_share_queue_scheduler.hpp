@@ -0,0 +1,608 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_FAIR_SHARE_SCHEDULER)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
+#include <hpx/threading_base/tenant.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_local_fair_share_queue_scheduler_terminated_queue =
+        lockfree_lifo;
+#else
+    using default_local_fair_share_queue_scheduler_terminated_queue =
+        lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_fair_share_queue_scheduler is a local_priority_queue_scheduler
+    /// which divides the processing time of the OS threads between tenants
+    /// (see threads::register_tenant). Each OS thread maintains one run queue
+    /// per tenant and selects the tenant to run next using weighted deficit
+    /// round robin: whenever a tenant's turn comes up its deficit is
+    /// increased by the quantum multiplied by the tenant's weight, and the
+    /// time spent executing threads of the tenant is subtracted from it. A
+    /// tenant is served as long as its deficit is positive. Tenants without
+    /// runnable threads lose their remaining deficit, so idle tenants can't
+    /// accumulate credit.
+    ///
+    /// Threads of the default tenant are held by the queues of the base
+    /// scheduler (and honor thread priorities), the threads of all other
+    /// tenants are scheduled with normal priority. Idle OS threads steal
+    /// from the tenant queues of other OS threads if stealing is enabled.
+    /// The scheduler never idles while there are runnable threads, even if
+    /// all tenants with work have exhausted their deficit.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_fair_share_queue_scheduler_terminated_queue>
+    class HPX_CORE_EXPORT local_fair_share_queue_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        /// The default quantum (in nanoseconds) a tenant with a weight of one
+        /// is granted per round
+        static constexpr std::int64_t default_quantum = 100000;
+
+    protected:
+        static_assert(max_tenants <= 64,
+            "the set of tenants having work is represented as a 64 bit mask");
+
+        using tenant_queue_type = typename PendingQueuing::template apply<
+            threads::thread_data*>::type;
+
+        struct tenant_data
+        {
+            tenant_data()
+              : queue_(nullptr)
+              , count_(0)
+              , cpu_time_(0)
+            {
+            }
+
+            // the queue is allocated when the first thread of the tenant is
+            // scheduled on the owning OS thread
+            std::atomic<tenant_queue_type*> queue_;
+            std::atomic<std::int64_t> count_;
+
+            // processing time spent by the owning OS thread on executing
+            // threads of this tenant
+            std::atomic<std::int64_t> cpu_time_;
+        };
+
+        struct worker_data
+        {
+            worker_data()
+              : current_(default_tenant)
+              , running_tenant_(default_tenant)
+              , started_(0)
+            {
+                for (std::int64_t& deficit : deficit_)
+                {
+                    deficit = 0;
+                }
+            }
+
+            ~worker_data()
+            {
+                for (tenant_data& t : tenants_)
+                {
+                    delete t.queue_.load(std::memory_order_relaxed);
+                }
+            }
+
+            tenant_data tenants_[max_tenants];
+
+            // the deficit round robin state is accessed by the owning OS
+            // thread only
+            std::int64_t deficit_[max_tenants];
+            tenant_id current_;
+
+            // the tenant of the thread which was handed out last and the
+            // time it was handed out (zero if the OS thread was idle)
+            tenant_id running_tenant_;
+            std::uint64_t started_;
+        };
+
+    public:
+        local_fair_share_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true,
+            std::int64_t quantum = default_quantum)
+          : base_type(init, deferred_initialization)
+          , quantum_(quantum > 0 ? quantum : std::int64_t(default_quantum))
+          , num_tenant_threads_(0)
+          , data_(init.num_queues_)
+        {
+            for (std::atomic<std::int64_t>& count : tenant_counts_)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_fair_share_queue_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(
+            thread_init_data& data, thread_id_type* id, error_code& ec) override
+        {
+            if (data.tenant == default_tenant || data.tenant >= max_tenants)
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            // Create the thread object right away, but don't put it into the
+            // queues of the base scheduler. The base scheduler selects the
+            // OS thread the new thread should be associated with.
+            thread_state_enum const initial_state = data.initial_state;
+
+            data.run_now = true;
+            data.initial_state = pending_do_not_schedule;
+
+            thread_id_type thrd;
+            base_type::create_thread(data, &thrd, ec);
+            if (!thrd)
+                return;
+
+            if (initial_state == pending || initial_state == pending_boost)
+            {
+                HPX_ASSERT(
+                    data.schedulehint.mode == thread_schedule_hint_mode_thread);
+                push_tenant_thread(get_thread_id_data(thrd),
+                    static_cast<std::size_t>(data.schedulehint.hint));
+            }
+
+            if (id)
+                *id = thrd;
+        }
+
+        void create_threads_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            // threads associated with a tenant are created one by one
+            if (std::any_of(
+                    data, data + count, [](thread_init_data const& d) {
+                        return d.tenant != default_tenant &&
+                            d.tenant < max_tenants;
+                    }))
+            {
+                scheduler_base::create_threads_bulk(data, count, ec);
+                return;
+            }
+            base_type::create_threads_bulk(data, count, ec);
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_data*& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+            worker_data& d = data_[num_thread].data_;
+
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+            charge_running_tenant(d, now);
+
+            bool const steal = running && enable_stealing;
+
+            if (num_tenant_threads_.load(std::memory_order_relaxed) == 0)
+            {
+                // only threads of the default tenant are around
+                if (base_type::get_next_thread(
+                        num_thread, running, thrd, enable_stealing))
+                {
+                    start_running_tenant(d, thrd, now);
+                    return true;
+                }
+                return false;
+            }
+
+            std::size_t const num_tenants = get_num_tenants();
+            if (d.current_ >= num_tenants)
+                d.current_ = default_tenant;
+
+            // Visit each tenant once, starting with the tenant which was
+            // served last (it may have deficit left).
+            for (std::size_t i = 0; i <= num_tenants; ++i)
+            {
+                tenant_id const tenant = d.current_;
+                std::int64_t& deficit = d.deficit_[tenant];
+
+                if (deficit > 0)
+                {
+                    if (pop_thread(tenant, num_thread, running, thrd,
+                            enable_stealing, steal))
+                    {
+                        start_running_tenant(d, thrd, now);
+                        return true;
+                    }
+
+                    // no work for this tenant, it loses its credit
+                    deficit = 0;
+                }
+
+                d.current_ = static_cast<tenant_id>((tenant + 1) % num_tenants);
+                d.deficit_[d.current_] +=
+                    quantum_ * get_tenant_weight(d.current_);
+            }
+
+            // All tenants having work have exhausted their deficit (this
+            // happens if threads run for longer than a quantum). Instead of
+            // idling, fast forward the rounds needed for the first of them to
+            // become eligible again.
+            if (skip_rounds(d, num_tenants))
+            {
+                if (pop_thread(d.current_, num_thread, running, thrd,
+                        enable_stealing, steal))
+                {
+                    start_running_tenant(d, thrd, now);
+                    return true;
+                }
+            }
+
+            for (std::size_t i = 0; i != num_tenants; ++i)
+            {
+                tenant_id const tenant =
+                    static_cast<tenant_id>((d.current_ + i) % num_tenants);
+                if (pop_thread(tenant, num_thread, running, thrd,
+                        enable_stealing, steal))
+                {
+                    start_running_tenant(d, thrd, now);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_data* thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority_normal) override
+        {
+            tenant_id const tenant = thrd->get_tenant();
+            if (tenant == default_tenant || tenant >= max_tenants)
+            {
+                base_type::schedule_thread(
+                    thrd, schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            push_tenant_thread(
+                thrd, select_queue(schedulehint, allow_fallback));
+        }
+
+        void schedule_thread_last(threads::thread_data* thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority_normal) override
+        {
+            tenant_id const tenant = thrd->get_tenant();
+            if (tenant == default_tenant || tenant >= max_tenants)
+            {
+                base_type::schedule_thread_last(
+                    thrd, schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            push_tenant_thread(
+                thrd, select_queue(schedulehint, allow_fallback));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues (work items and new
+        // items)
+        std::int64_t get_queue_length(
+            std::size_t num_thread = std::size_t(-1)) const override
+        {
+            std::int64_t count = base_type::get_queue_length(num_thread);
+
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return count + get_tenant_queue_length(num_thread);
+            }
+
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                count += get_tenant_queue_length(i);
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            if (num_thread < this->num_queues_ &&
+                get_tenant_queue_length(num_thread) != 0)
+            {
+                return false;
+            }
+            return base_type::is_core_idle(num_thread);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Returns the processing time (in nanoseconds) spent on executing
+        // threads of the given tenant
+        std::int64_t get_tenant_cpu_time(
+            tenant_id tenant, std::size_t num_thread, bool reset) override
+        {
+            if (tenant >= max_tenants)
+                return 0;
+
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return util::get_and_reset_value(
+                    data_[num_thread].data_.tenants_[tenant].cpu_time_, reset);
+            }
+
+            std::int64_t cpu_time = 0;
+            for (std::size_t i = 0; i != this->num_queues_; ++i)
+            {
+                cpu_time += util::get_and_reset_value(
+                    data_[i].data_.tenants_[tenant].cpu_time_, reset);
+            }
+            return cpu_time;
+        }
+
+    protected:
+        // select the queue a thread should be put into, this follows the
+        // logic of local_priority_queue_scheduler::schedule_thread
+        std::size_t select_queue(
+            threads::thread_schedule_hint schedulehint, bool allow_fallback)
+        {
+            // NOTE: This scheduler ignores NUMA hints.
+            std::size_t num_thread = std::size_t(-1);
+            if (schedulehint.mode == thread_schedule_hint_mode_thread)
+            {
+                num_thread = schedulehint.hint;
+            }
+            else
+            {
+                allow_fallback = false;
+            }
+
+            if (std::size_t(-1) == num_thread)
+            {
+                num_thread = this->curr_queue_++ % this->num_queues_;
+            }
+            else if (num_thread >= this->num_queues_)
+            {
+                num_thread %= this->num_queues_;
+            }
+
+            std::unique_lock<typename base_type::pu_mutex_type> l;
+            return this->select_active_pu(l, num_thread, allow_fallback);
+        }
+
+        std::int64_t get_tenant_queue_length(std::size_t num_thread) const
+        {
+            if (num_tenant_threads_.load(std::memory_order_relaxed) == 0)
+                return 0;
+
+            std::int64_t count = 0;
+            std::size_t const num_tenants = get_num_tenants();
+            for (std::size_t i = 1; i < num_tenants; ++i)
+            {
+                count += data_[num_thread].data_.tenants_[i].count_.load(
+                    std::memory_order_relaxed);
+            }
+            return count;
+        }
+
+        static tenant_queue_type* get_queue(tenant_data& t)
+        {
+            tenant_queue_type* q = t.queue_.load(std::memory_order_acquire);
+            if (q != nullptr)
+                return q;
+
+            tenant_queue_type* new_queue = new tenant_queue_type;
+            if (!t.queue_.compare_exchange_strong(
+                    q, new_queue, std::memory_order_acq_rel))
+            {
+                // another OS thread was faster
+                delete new_queue;
+                return q;
+            }
+            return new_queue;
+        }
+
+        void push_tenant_thread(
+            threads::thread_data* thrd, std::size_t num_thread)
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            tenant_id const tenant = thrd->get_tenant();
+            HPX_ASSERT(tenant != default_tenant && tenant < max_tenants);
+
+            tenant_data& t = data_[num_thread].data_.tenants_[tenant];
+
+            ++t.count_;
+            ++tenant_counts_[tenant];
+            ++num_tenant_threads_;
+
+            get_queue(t)->push(thrd);
+        }
+
+        bool pop_tenant_thread(tenant_data& t, threads::thread_data*& thrd)
+        {
+            tenant_queue_type* q = t.queue_.load(std::memory_order_acquire);
+            if (q == nullptr || !q->pop(thrd))
+                return false;
+
+            --t.count_;
+            return true;
+        }
+
+        // Pick a thread of the given tenant from the queues of the given OS
+        // thread or (if stealing is enabled) from the queues of the other OS
+        // threads.
+        bool pop_thread(tenant_id tenant, std::size_t num_thread, bool running,
+            threads::thread_data*& thrd, bool enable_stealing, bool steal)
+        {
+            if (tenant == default_tenant)
+            {
+                return base_type::get_next_thread(
+                    num_thread, running, thrd, enable_stealing);
+            }
+
+            if (tenant_counts_[tenant].load(std::memory_order_relaxed) == 0)
+                return false;
+
+            bool result = pop_tenant_thread(
+                data_[num_thread].data_.tenants_[tenant], thrd);
+
+            if (!result && steal)
+            {
+                result = this->for_each_victim(num_thread,
+                    [&](std::size_t idx, steal_distance distance) {
+                        HPX_ASSERT(idx != num_thread);
+                        if (!pop_tenant_thread(
+                                data_[idx].data_.tenants_[tenant], thrd))
+                        {
+                            return false;
+                        }
+
+                        this->victim_threads_[num_thread].data_.count_stolen(
+                            distance, 1);
+                        return true;
+                    });
+            }
+
+            if (result)
+            {
+                --tenant_counts_[tenant];
+                --num_tenant_threads_;
+            }
+            return result;
+        }
+
+        bool has_work(tenant_id tenant) const
+        {
+            if (tenant == default_tenant)
+                return base_type::get_queue_length(std::size_t(-1)) != 0;
+            return tenant_counts_[tenant].load(std::memory_order_relaxed) != 0;
+        }
+
+        // Grant all tenants having work the credit of the number of rounds
+        // needed for one of them to get a positive deficit, make that tenant
+        // the current one. Returns false if no tenant has work.
+        bool skip_rounds(worker_data& d, std::size_t num_tenants)
+        {
+            std::uint64_t with_work = 0;
+            std::int64_t min_rounds = -1;
+            tenant_id selected = default_tenant;
+
+            for (std::size_t i = 0; i != num_tenants; ++i)
+            {
+                tenant_id const tenant = static_cast<tenant_id>(i);
+                if (!has_work(tenant))
+                    continue;
+
+                with_work |= std::uint64_t(1) << i;
+
+                std::int64_t const credit =
+                    quantum_ * get_tenant_weight(tenant);
+                std::int64_t const rounds =
+                    d.deficit_[i] > 0 ? 0 : -d.deficit_[i] / credit + 1;
+                if (min_rounds < 0 || rounds < min_rounds)
+                {
+                    min_rounds = rounds;
+                    selected = tenant;
+                }
+            }
+
+            if (with_work == 0)
+                return false;
+
+            for (std::size_t i = 0; i != num_tenants; ++i)
+            {
+                if (with_work & (std::uint64_t(1) << i))
+                {
+                    d.deficit_[i] += min_rounds * quantum_ *
+                        get_tenant_weight(static_cast<tenant_id>(i));
+                }
+            }
+
+            d.current_ = selected;
+            return true;
+        }
+
+        void start_running_tenant(worker_data& d, threads::thread_data* thrd,
+            std::uint64_t now) noexcept
+        {
+            tenant_id const tenant = thrd->get_tenant();
+            d.running_tenant_ = tenant < max_tenants ? tenant : default_tenant;
+            d.started_ = now;
+        }
+
+        // charge the time since the last thread was handed out to its tenant
+        void charge_running_tenant(worker_data& d, std::uint64_t now) noexcept
+        {
+            if (d.started_ == 0)
+                return;
+
+            std::int64_t const elapsed = now > d.started_ ?
+                static_cast<std::int64_t>(now - d.started_) :
+                0;
+            d.started_ = 0;
+
+            d.tenants_[d.running_tenant_].cpu_time_.fetch_add(
+                elapsed, std::memory_order_relaxed);
+            d.deficit_[d.running_tenant_] -= elapsed;
+        }
+
+    protected:
+        std::int64_t const quantum_;
+
+        // overall number of threads held by the tenant queues
+        std::atomic<std::int64_t> num_tenant_threads_;
+        std::atomic<std::int64_t> tenant_counts_[max_tenants];
+
+        std::vector<util::cache_aligned_data<worker_data>> data_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
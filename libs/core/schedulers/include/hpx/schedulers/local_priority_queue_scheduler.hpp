@@ -18,15 +18,18 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -447,6 +450,26 @@ namespace hpx { namespace threads { namespace policies {
         }
 #endif
 
+        std::int64_t get_num_stolen_at_distance(std::size_t num_thread,
+            steal_distance distance, bool reset) override
+        {
+            auto get = [&](std::size_t i) {
+                std::atomic<std::int64_t>& stolen =
+                    victim_threads_[i]
+                        .data_.stolen_[static_cast<std::size_t>(distance)];
+                return reset ? stolen.exchange(0, std::memory_order_relaxed) :
+                               stolen.load(std::memory_order_relaxed);
+            };
+
+            if (num_thread != std::size_t(-1))
+                return get(num_thread);
+
+            std::int64_t num_stolen_threads = 0;
+            for (std::size_t i = 0; i != num_queues_; ++i)
+                num_stolen_threads += get(i);
+            return num_stolen_threads;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads() override
         {
@@ -554,6 +577,72 @@ namespace hpx { namespace threads { namespace policies {
             queues_[num_thread].data_->create_thread(data, id, ec);
         }
 
+        // create a range of threads which are not run immediately. Threads
+        // without a hint are distributed in contiguous chunks across all
+        // queues, every chunk is handed to its queue at once.
+        void create_threads_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            std::size_t const first_queue = curr_queue_++ % num_queues_;
+            auto target_queue = [&](std::size_t i) -> std::size_t {
+                if (data[i].schedulehint.mode ==
+                    thread_schedule_hint_mode_thread)
+                {
+                    return std::size_t(data[i].schedulehint.hint) %
+                        num_queues_;
+                }
+                return (first_queue + i * num_queues_ / count) % num_queues_;
+            };
+            auto is_bulk = [&](std::size_t i) {
+                return !data[i].run_now &&
+                    (data[i].priority == thread_priority_default ||
+                        data[i].priority == thread_priority_normal);
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!is_bulk(i))
+                {
+                    create_thread(data[i], nullptr, ec);
+                    if (ec)
+                        return;
+                    ++i;
+                    continue;
+                }
+
+                // collect all following threads going to the same queue
+                std::size_t num_thread = target_queue(i);
+                std::size_t last = i + 1;
+                while (last != count && is_bulk(last) &&
+                    target_queue(last) == num_thread)
+                {
+                    ++last;
+                }
+
+                std::unique_lock<pu_mutex_type> l;
+                num_thread = select_active_pu(l, num_thread);
+
+                for (std::size_t j = i; j != last; ++j)
+                {
+                    data[j].schedulehint.mode =
+                        thread_schedule_hint_mode_thread;
+                    data[j].schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                }
+
+                queues_[num_thread].data_->create_threads_bulk(
+                    data + i, last - i, ec);
+                if (ec)
+                    return;
+
+                i = last;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -598,30 +687,47 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                // steal half of the work of a victim at once if the victims
+                // are selected based on their distance
+                bool const steal_half =
+                    has_scheduler_mode(policies::enable_stealing_topology);
+
+                auto steal = [&](thread_queue_type* q,
+                                 thread_queue_type* this_q,
+                                 steal_distance distance) {
+                    if (!q->get_next_thread(thrd, running))
+                        return false;
+
+                    std::int64_t stolen = 1;
+                    if (steal_half)
+                        stolen += this_q->steal_half_work_items_from(q);
+
+                    q->increment_num_stolen_from_pending(
+                        static_cast<std::size_t>(stolen));
+                    this_q->increment_num_stolen_to_pending(
+                        static_cast<std::size_t>(stolen));
+                    victim_threads_[num_thread].data_.count_stolen(
+                        distance, stolen);
+                    return true;
+                };
 
-                    if (idx < num_high_priority_queues_ &&
-                        num_thread < num_high_priority_queues_)
-                    {
-                        thread_queue_type* q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, running))
+                bool stolen = for_each_victim(num_thread,
+                    [&](std::size_t idx, steal_distance distance) {
+                        HPX_ASSERT(idx != num_thread);
+
+                        if (idx < num_high_priority_queues_ &&
+                            num_thread < num_high_priority_queues_ &&
+                            steal(high_priority_queues_[idx].data_,
+                                this_high_priority_queue, distance))
                         {
-                            q->increment_num_stolen_from_pending();
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_pending();
                             return true;
                         }
-                    }
 
-                    if (queues_[idx].data_->get_next_thread(thrd, running))
-                    {
-                        queues_[idx].data_->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
-                        return true;
-                    }
-                }
+                        return steal(queues_[idx].data_, this_queue, distance);
+                    });
+
+                if (stolen)
+                    return true;
             }
 
             return low_priority_queue_.get_next_thread(thrd);
@@ -1062,39 +1168,37 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                auto steal = [&](thread_queue_type* q,
+                                 thread_queue_type* this_q,
+                                 steal_distance distance) {
+                    result = this_q->wait_or_add_new(true, added, q) && result;
+                    if (0 == added)
+                        return false;
+
+                    q->increment_num_stolen_from_staged(added);
+                    this_q->increment_num_stolen_to_staged(added);
+                    victim_threads_[num_thread].data_.count_stolen(
+                        distance, static_cast<std::int64_t>(added));
+                    return true;
+                };
 
-                    if (idx < num_high_priority_queues_ &&
-                        num_thread < num_high_priority_queues_)
-                    {
-                        thread_queue_type* q = high_priority_queues_[idx].data_;
-                        result = this_high_priority_queue->wait_or_add_new(
-                                     true, added, q) &&
-                            result;
+                bool stolen = for_each_victim(num_thread,
+                    [&](std::size_t idx, steal_distance distance) {
+                        HPX_ASSERT(idx != num_thread);
 
-                        if (0 != added)
+                        if (idx < num_high_priority_queues_ &&
+                            num_thread < num_high_priority_queues_ &&
+                            steal(high_priority_queues_[idx].data_,
+                                this_high_priority_queue, distance))
                         {
-                            q->increment_num_stolen_from_staged(added);
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_staged(added);
-                            return result;
+                            return true;
                         }
-                    }
 
-                    result = this_queue->wait_or_add_new(
-                                 true, added, queues_[idx].data_) &&
-                        result;
+                        return steal(queues_[idx].data_, this_queue, distance);
+                    });
 
-                    if (0 != added)
-                    {
-                        queues_[idx].data_->increment_num_stolen_from_staged(
-                            added);
-                        this_queue->increment_num_stolen_to_staged(added);
-                        return result;
-                    }
-                }
+                if (stolen)
+                    return result;
             }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -1171,13 +1275,17 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_threads = num_queues_;
             auto const& topo = create_topology();
 
-            // get NUMA domain masks of all queues...
+            // get NUMA domain, cache, and core masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> l3_masks(num_threads);
+            std::vector<mask_type> l2_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = affinity_data_.get_pu_num(i);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+                l3_masks[i] = topo.get_cache_affinity_mask(num_pu, 3);
+                l2_masks[i] = topo.get_cache_affinity_mask(num_pu, 2);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
             }
 
@@ -1185,13 +1293,36 @@ namespace hpx { namespace threads { namespace policies {
             // steal from
             std::ptrdiff_t radius =
                 std::lround(static_cast<double>(num_threads) / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
+
+            victim_list& victims = victim_threads_[num_thread].data_;
+            victims.reset(num_thread);
+            victims.threads_.reserve(num_threads);
+            victims.distances_.reserve(num_threads);
 
             std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type l3_mask = l3_masks[num_thread];
+            mask_cref_type l2_mask = l2_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
+            auto distance = [&](std::size_t other_num_thread) {
+                if (any(core_mask & core_masks[other_num_thread]))
+                    return steal_distance::core;
+                if (any(l2_mask & l2_masks[other_num_thread]))
+                    return steal_distance::l2_cache;
+                if (any(l3_mask & l3_masks[other_num_thread]))
+                    return steal_distance::l3_cache;
+                if (any(numa_mask & numa_masks[other_num_thread]))
+                    return steal_distance::numa_domain;
+                return steal_distance::remote_numa_domain;
+            };
+
+            auto add_victim = [&](std::size_t other_num_thread) {
+                victims.threads_.push_back(other_num_thread);
+                victims.distances_.push_back(distance(other_num_thread));
+            };
+
             // we allow the thread on the boundary of the NUMA domain to steal
             mask_type first_mask = mask_type();
             resize(first_mask, mask_size(pu_mask));
@@ -1217,14 +1348,13 @@ namespace hpx { namespace threads { namespace policies {
 
                         if (f(std::size_t(left)))
                         {
-                            victim_threads_[num_thread].data_.push_back(
-                                static_cast<std::size_t>(left));
+                            add_victim(static_cast<std::size_t>(left));
                         }
 
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            add_victim(right);
                         }
                     }
                     if ((num_threads % 2) == 0)
@@ -1232,7 +1362,7 @@ namespace hpx { namespace threads { namespace policies {
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            add_victim(right);
                         }
                     }
                 };
@@ -1256,6 +1386,27 @@ namespace hpx { namespace threads { namespace policies {
                     return !any(numa_mask & numa_masks[other_num_thread]);
                 });
             }
+
+            // if enable_stealing_topology is set, all threads are considered
+            // ordered by their distance, threads in other NUMA domains only
+            // if stealing across NUMA domains is enabled
+            for (std::size_t d = 0; d != num_steal_distances; ++d)
+            {
+                victims.groups_[d] = victims.by_distance_.size();
+
+                if (steal_distance(d) == steal_distance::remote_numa_domain &&
+                    !has_scheduler_mode(policies::enable_stealing_numa))
+                {
+                    continue;
+                }
+
+                for (std::size_t i = 0; i != num_threads; ++i)
+                {
+                    if (i != num_thread && distance(i) == steal_distance(d))
+                        victims.by_distance_.push_back(i);
+                }
+            }
+            victims.groups_[num_steal_distances] = victims.by_distance_.size();
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1291,6 +1442,94 @@ namespace hpx { namespace threads { namespace policies {
         }
 
     protected:
+        // The threads a worker thread steals from
+        struct victim_list
+        {
+            victim_list()
+            {
+                for (std::atomic<std::int64_t>& stolen : stolen_)
+                    stolen.store(0, std::memory_order_relaxed);
+            }
+
+            void reset(std::size_t num_thread)
+            {
+                threads_.clear();
+                distances_.clear();
+                by_distance_.clear();
+                std::fill(std::begin(groups_), std::end(groups_), 0);
+
+                // any non-zero seed will do
+                rng_state_ = (num_thread + 1) * 0x9e3779b97f4a7c15ULL;
+            }
+
+            // xorshift64, used to pick the first victim of each distance
+            std::size_t random() noexcept
+            {
+                rng_state_ ^= rng_state_ << 13;
+                rng_state_ ^= rng_state_ >> 7;
+                rng_state_ ^= rng_state_ << 17;
+                return static_cast<std::size_t>(rng_state_);
+            }
+
+            void count_stolen(steal_distance distance, std::int64_t count)
+            {
+                stolen_[static_cast<std::size_t>(distance)].fetch_add(
+                    count, std::memory_order_relaxed);
+            }
+
+            // victims in the (radial) default order and their distances
+            std::vector<std::size_t> threads_;
+            std::vector<steal_distance> distances_;
+
+            // victims ordered by distance, the victims of distance d are
+            // by_distance_[groups_[d]] ... by_distance_[groups_[d + 1] - 1]
+            std::vector<std::size_t> by_distance_;
+            std::size_t groups_[num_steal_distances + 1] = {};
+
+            std::uint64_t rng_state_ = 1;
+
+            // number of tasks stolen by this thread per distance
+            std::atomic<std::int64_t> stolen_[num_steal_distances];
+        };
+
+        // Invoke f(victim, distance) for the victims of the given thread
+        // until it returns true. If enable_stealing_topology is set, the
+        // victims are visited closest first, each group of victims with the
+        // same distance starting at a random victim.
+        template <typename F>
+        bool for_each_victim(std::size_t num_thread, F&& f)
+        {
+            victim_list& victims = victim_threads_[num_thread].data_;
+
+            if (!has_scheduler_mode(policies::enable_stealing_topology))
+            {
+                for (std::size_t i = 0; i != victims.threads_.size(); ++i)
+                {
+                    if (f(victims.threads_[i], victims.distances_[i]))
+                        return true;
+                }
+                return false;
+            }
+
+            for (std::size_t d = 0; d != num_steal_distances; ++d)
+            {
+                std::size_t const first = victims.groups_[d];
+                std::size_t const count = victims.groups_[d + 1] - first;
+                if (count == 0)
+                    continue;
+
+                std::size_t const start = victims.random() % count;
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    std::size_t const victim =
+                        victims.by_distance_[first + (start + i) % count];
+                    if (f(victim, steal_distance(d)))
+                        return true;
+                }
+            }
+            return false;
+        }
+
         std::atomic<std::size_t> curr_queue_;
 
         detail::affinity_data const& affinity_data_;
@@ -1303,8 +1542,7 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
-            victim_threads_;
+        std::vector<util::cache_line_data<victim_list>> victim_threads_;
     };
 }}}    // namespace hpx::threads::policies
 
@@ -717,6 +717,47 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // register task descriptions for a range of threads which are not
+        // run immediately, the counter of new tasks is updated only once
+        void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            if (count == 0)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            threads::thread_stacksize const self_stacksize =
+                get_self_stacksize_enum();
+
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#endif
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                HPX_ASSERT(!data[i].run_now);
+                if (data[i].stacksize == threads::thread_stacksize_current)
+                {
+                    data[i].stacksize = self_stacksize;
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{std::move(data[i]), now};
+#else
+                new (td) task_description{std::move(data[i])};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description* trd;
@@ -742,6 +783,38 @@ namespace hpx { namespace threads { namespace policies {
             }
         }
 
+        // Move up to half of the pending threads of the given queue to this
+        // queue, returns the number of threads moved.
+        std::int64_t steal_half_work_items_from(thread_queue* src)
+        {
+            std::int64_t const count =
+                src->work_items_count_.data_.load(std::memory_order_relaxed) /
+                2;
+
+            std::int64_t moved = 0;
+            thread_description* trd;
+            while (moved != count && src->work_items_.pop(trd, true))
+            {
+                --src->work_items_count_.data_;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                if (get_maintain_queue_wait_times_enabled())
+                {
+                    std::uint64_t now =
+                        hpx::chrono::high_resolution_clock::now();
+                    src->work_items_wait_ += now - trd->waittime;
+                    ++src->work_items_wait_count_;
+                    trd->waittime = now;
+                }
+#endif
+
+                ++work_items_count_.data_;
+                work_items_.push(trd);
+                ++moved;
+            }
+            return moved;
+        }
+
         void move_task_items_from(thread_queue* src, std::int64_t count)
         {
             task_description* task;
@@ -11,5 +11,6 @@
 #if defined(HPX_HAVE_DATAPAR)
 
 #include <hpx/serialization/detail/vc.hpp>
+#include <hpx/serialization/detail/simd.hpp>
 
 #endif
@@ -0,0 +1,227 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A log-linear (HDR-style) histogram of non-negative integral values.
+    ///
+    /// Values smaller than 2^sub_bucket_bits are counted exactly. Larger
+    /// values are counted in buckets whose width doubles with each power of
+    /// two, each power of two being split into 2^sub_bucket_bits linear
+    /// sub-buckets. This bounds the relative error of any reported value to
+    /// 2^-sub_bucket_bits while keeping the number of buckets small. Values
+    /// larger than 2^max_value_bits are counted in the last bucket.
+    ///
+    /// Recording a value is lock-free. The histogram holds a configurable
+    /// number of slots (usually one per worker thread), each with its own set
+    /// of buckets. Writers record into their own slot, readers merge all
+    /// slots on demand. Concurrent writers to the same slot are supported
+    /// but contend on the same cache lines.
+    class log_linear_histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 4;
+        static constexpr std::size_t max_value_bits = 48;
+
+        static constexpr std::size_t sub_bucket_count = std::size_t(1)
+            << sub_bucket_bits;
+        static constexpr std::size_t num_buckets =
+            (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+        using counts_type = std::vector<std::uint64_t>;
+
+        explicit log_linear_histogram(std::size_t num_slots = 1)
+          : num_slots_(num_slots == 0 ? 1 : num_slots)
+          , buckets_(new std::atomic<std::uint64_t>[num_slots_ * num_buckets])
+        {
+            for (std::size_t i = 0; i != num_slots_ * num_buckets; ++i)
+            {
+                buckets_[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        log_linear_histogram(log_linear_histogram&&) = default;
+        log_linear_histogram& operator=(log_linear_histogram&&) = default;
+
+        std::size_t num_slots() const noexcept
+        {
+            return num_slots_;
+        }
+
+        /// Record the given value in the buckets of the given slot, which
+        /// has to be smaller than num_slots().
+        void record(std::uint64_t value, std::size_t slot = 0) noexcept
+        {
+            HPX_ASSERT(slot < num_slots_);
+            std::atomic<std::uint64_t>& bucket =
+                buckets_[slot * num_buckets + bucket_index(value)];
+            bucket.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Add the counts of all slots to the given counts (which will be
+        /// resized to num_buckets if necessary). Optionally reset all
+        /// buckets afterwards.
+        void accumulate(counts_type& counts, bool reset = false) noexcept
+        {
+            if (counts.size() != num_buckets)
+                counts.resize(num_buckets, 0);
+
+            for (std::size_t slot = 0; slot != num_slots_; ++slot)
+            {
+                accumulate(slot, counts, reset);
+            }
+        }
+
+        /// Add the counts of the given slot to the given counts
+        void accumulate(std::size_t slot, counts_type& counts,
+            bool reset = false) noexcept
+        {
+            if (counts.size() != num_buckets)
+                counts.resize(num_buckets, 0);
+
+            HPX_ASSERT(slot < num_slots_);
+            std::atomic<std::uint64_t>* buckets =
+                &buckets_[slot * num_buckets];
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                counts[i] += reset ?
+                    buckets[i].exchange(0, std::memory_order_relaxed) :
+                    buckets[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        /// Return the value at the given percentile (0..100) of all values
+        /// recorded in all slots.
+        std::uint64_t get_percentile(double percentile, bool reset = false)
+        {
+            counts_type counts;
+            accumulate(counts, reset);
+            return get_percentile(counts, percentile);
+        }
+
+        /// Return the number of values recorded in all slots.
+        std::uint64_t get_count(bool reset = false)
+        {
+            counts_type counts;
+            accumulate(counts, reset);
+            return get_count(counts);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        static std::uint64_t get_count(counts_type const& counts) noexcept
+        {
+            std::uint64_t count = 0;
+            for (std::uint64_t c : counts)
+            {
+                count += c;
+            }
+            return count;
+        }
+
+        /// Return the value at the given percentile (0..100) of the given
+        /// (accumulated) counts. The reported value is the largest value
+        /// which is equivalent to the bucket the percentile falls into.
+        static std::uint64_t get_percentile(
+            counts_type const& counts, double percentile) noexcept
+        {
+            std::uint64_t const count = get_count(counts);
+            if (count == 0)
+                return 0;
+
+            if (percentile < 0.0)
+                percentile = 0.0;
+            else if (percentile > 100.0)
+                percentile = 100.0;
+
+            // the rank of the value to report, at least one
+            std::uint64_t rank =
+                static_cast<std::uint64_t>(percentile / 100.0 * double(count));
+            if (rank == 0)
+                rank = 1;
+            else if (rank > count)
+                rank = count;
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i != counts.size(); ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                    return bucket_highest_value(i);
+            }
+
+            HPX_ASSERT(false);
+            return bucket_highest_value(counts.size() - 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        static std::size_t bucket_index(std::uint64_t value) noexcept
+        {
+            if (value < sub_bucket_count)
+                return static_cast<std::size_t>(value);
+
+            std::size_t const msb = most_significant_bit(value);
+            if (msb >= max_value_bits)
+                return num_buckets - 1;
+
+            // the sub-bucket is determined by the sub_bucket_bits bits
+            // following the most significant bit
+            std::size_t const shift = msb - sub_bucket_bits;
+            std::size_t const sub_bucket = static_cast<std::size_t>(
+                (value >> shift) & (sub_bucket_count - 1));
+
+            return (shift + 1) * sub_bucket_count + sub_bucket;
+        }
+
+        static std::uint64_t bucket_lowest_value(std::size_t index) noexcept
+        {
+            std::size_t const exponent = index / sub_bucket_count;
+            std::uint64_t const sub_bucket = index % sub_bucket_count;
+            if (exponent == 0)
+                return sub_bucket;
+
+            return (sub_bucket_count + sub_bucket) << (exponent - 1);
+        }
+
+        static std::uint64_t bucket_highest_value(std::size_t index) noexcept
+        {
+            std::size_t const exponent = index / sub_bucket_count;
+            if (exponent == 0)
+                return bucket_lowest_value(index);
+
+            return bucket_lowest_value(index) +
+                (std::uint64_t(1) << (exponent - 1)) - 1;
+        }
+
+    private:
+        static std::size_t most_significant_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t msb = 0;
+            while (value >>= 1)
+                ++msb;
+            return msb;
+#endif
+        }
+
+        std::size_t num_slots_;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,122 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::util::log_linear_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bucket_boundaries()
+{
+    // small values are counted exactly
+    for (std::uint64_t v = 0; v != log_linear_histogram::sub_bucket_count; ++v)
+    {
+        std::size_t idx = log_linear_histogram::bucket_index(v);
+        HPX_TEST_EQ(log_linear_histogram::bucket_lowest_value(idx), v);
+        HPX_TEST_EQ(log_linear_histogram::bucket_highest_value(idx), v);
+    }
+
+    // all other values fall into a bucket bounding them with bounded error
+    for (std::uint64_t v = log_linear_histogram::sub_bucket_count;
+         v < (std::uint64_t(1) << 40); v = v * 3 / 2 + 1)
+    {
+        std::size_t idx = log_linear_histogram::bucket_index(v);
+        HPX_TEST_LT(idx, log_linear_histogram::num_buckets);
+
+        std::uint64_t lowest = log_linear_histogram::bucket_lowest_value(idx);
+        std::uint64_t highest = log_linear_histogram::bucket_highest_value(idx);
+        HPX_TEST_LTE(lowest, v);
+        HPX_TEST_LTE(v, highest);
+        HPX_TEST_LTE(highest - lowest,
+            lowest / log_linear_histogram::sub_bucket_count);
+
+        // neighboring buckets are adjacent
+        HPX_TEST_EQ(log_linear_histogram::bucket_index(highest + 1), idx + 1);
+    }
+
+    // huge values are clamped to the last bucket
+    HPX_TEST_EQ(log_linear_histogram::bucket_index(std::uint64_t(-1)),
+        log_linear_histogram::num_buckets - 1);
+}
+
+void test_percentiles()
+{
+    log_linear_histogram h;
+    HPX_TEST_EQ(h.get_percentile(50), std::uint64_t(0));
+
+    for (std::uint64_t v = 1; v <= 1000; ++v)
+    {
+        h.record(v);
+    }
+
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(1000));
+
+    std::uint64_t p50 = h.get_percentile(50);
+    std::uint64_t p99 = h.get_percentile(99);
+    std::uint64_t p999 = h.get_percentile(99.9);
+
+    HPX_TEST_LTE(std::uint64_t(500), p50);
+    HPX_TEST_LTE(p50, std::uint64_t(500 + 500 / 16));
+    HPX_TEST_LTE(std::uint64_t(990), p99);
+    HPX_TEST_LTE(p99, std::uint64_t(990 + 990 / 16));
+    HPX_TEST_LTE(p99, p999);
+    HPX_TEST_LTE(std::uint64_t(999), p999);
+
+    // reading with reset empties the histogram
+    HPX_TEST_EQ(h.get_count(true), std::uint64_t(1000));
+    HPX_TEST_EQ(h.get_count(), std::uint64_t(0));
+}
+
+void test_concurrent_recording()
+{
+    std::size_t const num_threads = 4;
+    std::size_t const num_values = 10000;
+
+    log_linear_histogram h(num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&h, t, num_values]() {
+            for (std::size_t i = 0; i != num_values; ++i)
+            {
+                h.record(i, t);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    log_linear_histogram::counts_type counts;
+    h.accumulate(counts);
+    HPX_TEST_EQ(log_linear_histogram::get_count(counts),
+        std::uint64_t(num_threads * num_values));
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        log_linear_histogram::counts_type slot_counts;
+        h.accumulate(t, slot_counts);
+        HPX_TEST_EQ(log_linear_histogram::get_count(slot_counts),
+            std::uint64_t(num_values));
+    }
+}
+
+int main()
+{
+    test_bucket_boundaries();
+    test_percentiles();
+    test_concurrent_recording();
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/thread_pools/scheduling_loop.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
@@ -75,6 +76,8 @@ namespace hpx { namespace threads { namespace detail {
             error_code& ec) override;
 
         void create_work(thread_init_data& data, error_code& ec) override;
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
 
         thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -214,6 +217,32 @@ namespace hpx { namespace threads { namespace detail {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
 #endif
+        std::int64_t get_num_missed_deadlines(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_missed_deadlines(num, reset);
+        }
+
+        std::int64_t get_average_deadline_lateness(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_average_deadline_lateness(
+                num, reset);
+        }
+
+        std::int64_t get_tenant_cpu_time(
+            tenant_id tenant, std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_tenant_cpu_time(tenant, num, reset);
+        }
+
+        std::int64_t get_num_stolen_at_distance(std::size_t num,
+            policies::steal_distance distance, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_at_distance(
+                num, distance, reset);
+        }
+
         std::int64_t get_queue_length(
             std::size_t num_thread, bool reset) override
         {
@@ -241,6 +270,8 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t get_executed_thread_phases(std::size_t, bool) override;
 #if defined(HPX_HAVE_THREAD_IDLE_RATES)
         std::int64_t get_thread_phase_duration(std::size_t, bool) override;
+        void get_thread_phase_duration_histogram(std::size_t,
+            util::log_linear_histogram::counts_type&, bool) override;
         std::int64_t get_thread_duration(std::size_t, bool) override;
         std::int64_t get_thread_phase_overhead(std::size_t, bool) override;
         std::int64_t get_thread_overhead(std::size_t, bool) override;
@@ -404,6 +435,12 @@ namespace hpx { namespace threads { namespace detail {
 
         std::vector<scheduling_counter_data> counter_data_;
 
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        // distribution of the durations of executed thread phases, one slot
+        // per worker thread
+        util::log_linear_histogram exec_time_histogram_;
+#endif
+
         // support detail::manage_executor interface
         std::atomic<long> thread_count_;
         std::atomic<std::int64_t> tasks_scheduled_;
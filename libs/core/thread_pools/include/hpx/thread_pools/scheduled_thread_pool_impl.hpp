@@ -487,6 +487,11 @@ namespace hpx { namespace threads { namespace detail {
                     counter_data.tasks_active_);
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
 
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+                counters.exec_time_histogram_ = &exec_time_histogram_;
+                counters.exec_time_histogram_slot_ = thread_num;
+#endif
+
                 detail::scheduling_callbacks callbacks(
                     util::deferred_call(    //-V107
                         &policies::scheduler_base::idle_callback, sched_.get(),
@@ -611,6 +616,26 @@ namespace hpx { namespace threads { namespace detail {
         ++tasks_scheduled_;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_->Scheduler::is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -764,6 +789,20 @@ namespace hpx { namespace threads { namespace detail {
     }
 
 #if defined(HPX_HAVE_THREAD_IDLE_RATES)
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::get_thread_phase_duration_histogram(
+        std::size_t num, util::log_linear_histogram::counts_type& counts,
+        bool reset)
+    {
+        if (num != std::size_t(-1))
+        {
+            exec_time_histogram_.accumulate(num, counts, reset);
+            return;
+        }
+
+        exec_time_histogram_.accumulate(counts, reset);
+    }
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_thread_phase_duration(
         std::size_t num, bool reset)
@@ -1816,6 +1855,9 @@ namespace hpx { namespace threads { namespace detail {
         std::size_t pool_threads)
     {
         counter_data_.resize(pool_threads);
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        exec_time_histogram_ = util::log_linear_histogram(pool_threads);
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -13,9 +13,12 @@
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_trace.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -224,16 +227,27 @@ namespace hpx { namespace threads { namespace detail {
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     struct idle_collect_rate
     {
-        idle_collect_rate(std::int64_t& tfunc_time, std::int64_t& exec_time)
+        idle_collect_rate(std::int64_t& tfunc_time, std::int64_t& exec_time,
+            util::log_linear_histogram* exec_time_histogram = nullptr,
+            std::size_t exec_time_histogram_slot = 0)
           : start_timestamp_(util::hardware::timestamp())
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
+          , exec_time_histogram_(exec_time_histogram)
+          , exec_time_histogram_slot_(exec_time_histogram_slot)
         {
         }
 
         void collect_exec_time(std::int64_t timestamp)
         {
-            exec_time_ += util::hardware::timestamp() - timestamp;
+            std::int64_t const exec_time =
+                util::hardware::timestamp() - timestamp;
+            exec_time_ += exec_time;
+            if (exec_time_histogram_ != nullptr && exec_time > 0)
+            {
+                exec_time_histogram_->record(
+                    std::uint64_t(exec_time), exec_time_histogram_slot_);
+            }
         }
         void take_snapshot()
         {
@@ -253,6 +267,10 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t& tfunc_time_;
         std::int64_t& exec_time_;
+
+        // optional histogram of the durations of all executed thread phases
+        util::log_linear_histogram* exec_time_histogram_;
+        std::size_t exec_time_histogram_slot_;
     };
 
     struct exec_time_wrapper
@@ -352,6 +370,11 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& background_send_duration_;
         std::int64_t& background_receive_duration_;
         bool& is_active_;
+
+        // optional histogram collecting the durations of thread phases, this
+        // worker records into the given slot
+        util::log_linear_histogram* exec_time_histogram_ = nullptr;
+        std::size_t exec_time_histogram_slot_ = 0;
     };
 #else
     struct scheduling_counters
@@ -377,6 +400,13 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
         bool& is_active_;
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        // optional histogram collecting the durations of thread phases, this
+        // worker records into the given slot
+        util::log_linear_histogram* exec_time_histogram_ = nullptr;
+        std::size_t exec_time_histogram_slot_ = 0;
+#endif
     };
 
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
@@ -579,7 +609,12 @@ namespace hpx { namespace threads { namespace detail {
             counters.background_work_duration_;
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
 
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_,
+            counters.exec_time_histogram_, counters.exec_time_histogram_slot_);
+#else
         idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_);
+#endif
         tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
         // spin for some time after queues have become empty
@@ -605,6 +640,9 @@ namespace hpx { namespace threads { namespace detail {
             context_storage =
                 hpx::execution_base::this_thread::detail::get_agent_storage();
 
+        // the task tracer keeps one buffer per (global) worker thread
+        std::size_t const global_thread_num = hpx::get_worker_thread_num();
+
         std::size_t added = std::size_t(-1);
         thread_data* next_thrd = nullptr;
         while (true)
@@ -665,6 +703,12 @@ namespace hpx { namespace threads { namespace detail {
                         {
                             tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
+                            std::uint64_t trace_begin = 0;
+                            if (HPX_UNLIKELY(task_trace::enabled()))
+                            {
+                                trace_begin = util::hardware::timestamp();
+                            }
+
                             // thread returns new required state
                             // store the returned state in the thread
                             {
@@ -712,6 +756,12 @@ namespace hpx { namespace threads { namespace detail {
 #endif
                             }
 
+                            if (HPX_UNLIKELY(trace_begin != 0))
+                            {
+                                task_trace::record(global_thread_num, thrd,
+                                    trace_begin, thrd_stat.get_previous());
+                            }
+
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
                             ++counters.executed_thread_phases_;
 #endif
@@ -857,6 +907,13 @@ namespace hpx { namespace threads { namespace detail {
             {
                 --idle_loop_count;
 
+                // write a task trace requested asynchronously (i.e. from a
+                // signal handler)
+                if (HPX_UNLIKELY(task_trace::dump_requested()))
+                {
+                    task_trace::handle_dump_request();
+                }
+
                 if (scheduler.SchedulingPolicy::wait_or_add_new(num_thread,
                         running, idle_loop_count, enable_stealing_staged,
                         added))
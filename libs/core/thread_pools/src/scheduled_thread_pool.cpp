@@ -31,6 +31,22 @@ template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::static_priority_queue_scheduler<>>;
 #endif
 
+#if defined(HPX_HAVE_LOCAL_DEADLINE_SCHEDULER)
+#include <hpx/schedulers/local_deadline_queue_scheduler.hpp>
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_deadline_queue_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_deadline_queue_scheduler<>>;
+#endif
+
+#if defined(HPX_HAVE_FAIR_SHARE_SCHEDULER)
+#include <hpx/schedulers/local_fair_share_queue_scheduler.hpp>
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_fair_share_queue_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_fair_share_queue_scheduler<>>;
+#endif
+
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 template class HPX_CORE_EXPORT
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
@@ -10,6 +10,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/tenant.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -72,6 +73,11 @@ namespace hpx { namespace threads { namespace detail {
         if (nullptr == data.scheduler_base)
             data.scheduler_base = scheduler;
 
+        // Threads not explicitly associated with a tenant inherit the
+        // current tenant.
+        if (data.tenant == default_tenant)
+            data.tenant = get_current_tenant();
+
         // Pass critical priority from parent to child (but only if there is
         // none is explicitly specified).
         if (self)
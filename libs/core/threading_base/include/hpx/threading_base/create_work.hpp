@@ -10,13 +10,17 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/tenant.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
 #include <sstream>
 
 namespace hpx { namespace threads { namespace detail {
-    inline void create_work(policies::scheduler_base* scheduler,
+    // verify the given data and fill in the defaults, returns false if the
+    // data is invalid
+    inline bool prepare_work(policies::scheduler_base* scheduler,
         thread_init_data& data, error_code& ec = throws)
     {
         // verify parameters
@@ -35,7 +39,7 @@ namespace hpx { namespace threads { namespace detail {
                  << get_thread_state_name(data.initial_state);
             HPX_THROWS_IF(
                 ec, bad_parameter, "thread::detail::create_work", strm.str());
-            return;
+            return false;
         }
         }
 
@@ -44,7 +48,7 @@ namespace hpx { namespace threads { namespace detail {
         {
             HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
                 "description is nullptr");
-            return;
+            return false;
         }
 #endif
 
@@ -75,6 +79,11 @@ namespace hpx { namespace threads { namespace detail {
         if (nullptr == data.scheduler_base)
             data.scheduler_base = scheduler;
 
+        // Threads not explicitly associated with a tenant inherit the
+        // current tenant.
+        if (data.tenant == default_tenant)
+            data.tenant = get_current_tenant();
+
         // Pass critical priority from parent to child.
         if (self)
         {
@@ -94,10 +103,34 @@ namespace hpx { namespace threads { namespace detail {
             thread_priority_high_recursive == data.priority ||
             thread_priority_boost == data.priority);
 
+        return true;
+    }
+
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data& data, error_code& ec = throws)
+    {
+        if (!prepare_work(scheduler, data, ec))
+            return;
+
         scheduler->create_thread(data, nullptr, ec);
 
         // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
         // thread.
         scheduler->do_some_work(data.schedulehint.hint);
     }
+
+    inline void create_work_bulk(policies::scheduler_base* scheduler,
+        thread_init_data* data, std::size_t count, error_code& ec = throws)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!prepare_work(scheduler, data[i], ec))
+                return;
+        }
+
+        scheduler->create_threads_bulk(data, count, ec);
+
+        // the new threads are spread over all queues, wake up all threads
+        scheduler->do_some_work(std::size_t(-1));
+    }
 }}}    // namespace hpx::threads::detail
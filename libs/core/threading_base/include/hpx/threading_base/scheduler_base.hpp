@@ -14,6 +14,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -178,6 +179,36 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread, bool reset) = 0;
 #endif
 
+        // deadline statistics, only schedulers which support threads with
+        // deadlines override these
+        virtual std::int64_t get_num_missed_deadlines(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_average_deadline_lateness(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // number of tasks stolen from workers at the given distance, only
+        // schedulers counting stolen tasks per distance override this
+        virtual std::int64_t get_num_stolen_at_distance(
+            std::size_t /*num_thread*/, steal_distance /*distance*/,
+            bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // processing time spent on behalf of the given tenant, only
+        // schedulers supporting fair-share scheduling override this
+        virtual std::int64_t get_tenant_cpu_time(tenant_id /*tenant*/,
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
@@ -208,6 +239,11 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_type* id, error_code& ec) = 0;
 
+        // create a range of threads which are not run immediately, the
+        // default implementation creates them one by one
+        virtual void create_threads_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_data*& thrd, bool enable_stealing) = 0;
 
@@ -302,6 +338,17 @@ namespace hpx { namespace threads { namespace policies {
                 &null_polling_function, std::memory_order_relaxed);
         }
 
+        void set_io_polling_function(polling_function_ptr io_func)
+        {
+            polling_function_io_.store(io_func, std::memory_order_relaxed);
+        }
+
+        void clear_io_polling_function()
+        {
+            polling_function_io_.store(
+                &null_polling_function, std::memory_order_relaxed);
+        }
+
         inline void custom_polling_function() const
         {
 #if defined(HPX_HAVE_MODULE_ASYNC_MPI)
@@ -309,6 +356,9 @@ namespace hpx { namespace threads { namespace policies {
 #endif
 #if defined(HPX_HAVE_MODULE_ASYNC_CUDA)
             (*polling_function_cuda_.load(std::memory_order_relaxed))();
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO)
+            (*polling_function_io_.load(std::memory_order_relaxed))();
 #endif
         }
 
@@ -346,6 +396,7 @@ namespace hpx { namespace threads { namespace policies {
 
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
+        std::atomic<polling_function_ptr> polling_function_io_;
 
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
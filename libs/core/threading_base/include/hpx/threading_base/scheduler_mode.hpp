@@ -58,6 +58,12 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers that support it to select the
+        /// threads to steal from ordered by their distance in the hardware
+        /// topology (same core, shared L2, shared L3, same NUMA domain,
+        /// other NUMA domains) and to steal half of the work of a victim at
+        /// once
+        enable_stealing_topology = 0x1000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +89,8 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            enable_stealing_topology
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
@@ -0,0 +1,45 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes how close the worker thread a task was stolen from is to
+    /// the stealing worker thread in the hardware topology. Schedulers
+    /// supporting work stealing count the stolen tasks per distance.
+    enum class steal_distance
+    {
+        /// both threads run on the same core
+        core = 0,
+        /// the threads share an L2 cache
+        l2_cache = 1,
+        /// the threads share an L3 cache
+        l3_cache = 2,
+        /// the threads share a NUMA domain
+        numa_domain = 3,
+        /// the threads run in different NUMA domains
+        remote_numa_domain = 4
+    };
+
+    /// The number of distinct steal distances
+    constexpr std::size_t num_steal_distances = 5;
+
+    /// Return the name of the given distance ("core", "l2", "l3", "numa" or
+    /// "remote")
+    HPX_CORE_EXPORT char const* get_steal_distance_name(
+        steal_distance distance) noexcept;
+
+    /// Return the distance with the given name
+    HPX_CORE_EXPORT steal_distance get_steal_distance(
+        std::string const& name, error_code& ec = throws);
+}}}    // namespace hpx::threads::policies
@@ -0,0 +1,93 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads {
+    ///////////////////////////////////////////////////////////////////////////
+    /// One execution of an HPX thread (a thread phase) on a worker thread.
+    /// The event is a 'begin' if this was the first phase of the thread and a
+    /// 'resume' otherwise, it ended with the thread being terminated ('end')
+    /// or suspended/yielded ('suspend').
+    struct task_trace_event
+    {
+        std::uint64_t begin_;    // hardware timestamps
+        std::uint64_t end_;
+        void const* id_;
+        void const* parent_id_;
+        util::thread_description description_;
+        std::size_t phase_;
+        thread_state_enum state_;    // state after execution
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The task tracer records task_trace_events into fixed size per worker
+    /// ring buffers. It is compiled in unconditionally but records nothing
+    /// until it is enabled. The recorded events can be written as a Chrome
+    /// trace (JSON), which can be loaded into chrome://tracing or Perfetto.
+    class HPX_CORE_EXPORT task_trace
+    {
+    public:
+        /// Allocate the ring buffers (capacity events for each of the given
+        /// number of worker threads) and start recording. Dumps requested
+        /// asynchronously are written to the given file. The ring buffers
+        /// are allocated only once, later calls re-enable recording only.
+        static void enable(std::size_t num_threads, std::size_t capacity,
+            std::string const& dump_filename = "hpx_task_trace.json");
+
+        /// Stop recording, the recorded events stay available for dump().
+        static void disable() noexcept;
+
+        static bool enabled() noexcept
+        {
+            return enabled_.load(std::memory_order_acquire);
+        }
+
+        /// Record the execution of the given thread which started at the
+        /// given timestamp and returned the given state.
+        static void record(std::size_t global_thread_num,
+            thread_data const* thrd, std::uint64_t begin,
+            thread_state_enum state) noexcept;
+
+        /// Write the currently recorded events to the given file.
+        static void dump(std::string const& filename, error_code& ec = throws);
+
+        /// Request a dump to the file given to enable(). This is safe to be
+        /// called from a signal handler, the dump is written by the next
+        /// idling worker thread.
+        static void request_dump() noexcept
+        {
+            dump_requested_.store(true, std::memory_order_relaxed);
+        }
+
+        static bool dump_requested() noexcept
+        {
+            return dump_requested_.load(std::memory_order_relaxed);
+        }
+
+        /// Write a dump if one was requested. Errors are logged only.
+        static void handle_dump_request();
+
+    private:
+        static std::atomic<bool> enabled_;
+        static std::atomic<bool> dump_requested_;
+    };
+}}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
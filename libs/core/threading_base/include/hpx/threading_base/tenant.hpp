@@ -0,0 +1,80 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Identifies the tenant (workload) a thread belongs to. Schedulers
+    /// supporting fair-share scheduling (local_fair_share_queue_scheduler)
+    /// divide the processing time of a thread pool between the tenants
+    /// according to their weights. All other schedulers ignore the tenant.
+    using tenant_id = std::uint16_t;
+
+    /// The tenant of all threads not explicitly associated with a tenant
+    constexpr tenant_id default_tenant = 0;
+
+    /// The maximal number of tenants (including the default tenant)
+    constexpr std::size_t max_tenants = 64;
+
+    /// Register a new tenant with the given name and weight, or update the
+    /// weight of the tenant if it was registered before. The default tenant
+    /// is registered as "default" with a weight of one.
+    ///
+    /// \returns The id of the tenant.
+    HPX_CORE_EXPORT tenant_id register_tenant(std::string const& name,
+        std::uint32_t weight = 1, error_code& ec = throws);
+
+    /// Return the id of the tenant registered with the given name
+    HPX_CORE_EXPORT tenant_id get_tenant_id(
+        std::string const& name, error_code& ec = throws);
+
+    /// Return the name of the given tenant
+    HPX_CORE_EXPORT std::string get_tenant_name(tenant_id tenant);
+
+    /// Return the weight of the given tenant
+    HPX_CORE_EXPORT std::uint32_t get_tenant_weight(tenant_id tenant) noexcept;
+
+    /// Change the weight of the given tenant
+    HPX_CORE_EXPORT void set_tenant_weight(
+        tenant_id tenant, std::uint32_t weight, error_code& ec = throws);
+
+    /// Return the number of registered tenants (including the default
+    /// tenant), all tenant ids are smaller than this number.
+    HPX_CORE_EXPORT std::size_t get_num_tenants() noexcept;
+
+    /// Return the tenant new threads are associated with if no tenant is
+    /// given explicitly. This is the tenant set by the innermost active
+    /// scoped_tenant on the current OS thread or, if there is none, the
+    /// tenant of the calling HPX thread.
+    HPX_CORE_EXPORT tenant_id get_current_tenant() noexcept;
+
+    /// Associates all threads created on the current OS thread during the
+    /// lifetime of this object with the given tenant.
+    class HPX_CORE_EXPORT scoped_tenant
+    {
+    public:
+        explicit scoped_tenant(tenant_id tenant) noexcept;
+        ~scoped_tenant();
+
+        scoped_tenant(scoped_tenant const&) = delete;
+        scoped_tenant& operator=(scoped_tenant const&) = delete;
+
+    private:
+        std::int32_t previous_;
+    };
+}}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
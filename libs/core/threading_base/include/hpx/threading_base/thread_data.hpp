@@ -462,6 +462,22 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        // absolute deadline of this thread (see thread_init_data::deadline)
+        std::uint64_t get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
+        // the tenant this thread belongs to
+        tenant_id get_tenant() const noexcept
+        {
+            return tenant_;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -629,6 +645,8 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
+        tenant_id tenant_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
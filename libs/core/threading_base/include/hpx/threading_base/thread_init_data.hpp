@@ -14,6 +14,7 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#include <hpx/threading_base/tenant.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -45,6 +46,8 @@ namespace hpx { namespace threads {
           , initial_state(pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , deadline(0)
+          , tenant(default_tenant)
         {
         }
 
@@ -57,6 +60,8 @@ namespace hpx { namespace threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            deadline = rhs.deadline;
+            tenant = rhs.tenant;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = rhs.description;
 #endif
@@ -95,6 +100,8 @@ namespace hpx { namespace threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , deadline(rhs.deadline)
+          , tenant(rhs.tenant)
         {
         }
 
@@ -126,6 +133,8 @@ namespace hpx { namespace threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , deadline(0)
+          , tenant(default_tenant)
         {
             HPX_UNUSED(desc);
         }
@@ -153,5 +162,13 @@ namespace hpx { namespace threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // absolute deadline (hpx::chrono::high_resolution_clock, in
+        // nanoseconds) the thread should have finished by, zero if none
+        std::uint64_t deadline;
+
+        // the tenant the thread belongs to, threads created with the default
+        // tenant inherit the current tenant (see get_current_tenant)
+        tenant_id tenant;
     };
 }}    // namespace hpx::threads
@@ -12,10 +12,12 @@
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/topology/cpu_mask.hpp>
@@ -235,6 +237,8 @@ namespace hpx { namespace threads {
         virtual void create_thread(
             thread_init_data& data, thread_id_type& id, error_code& ec) = 0;
         virtual void create_work(thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -258,6 +262,11 @@ namespace hpx { namespace threads {
         {
             return thread_offset_;
         }
+        // factor converting timestamps of this pool to nanoseconds
+        double get_timestamp_scale() const
+        {
+            return timestamp_scale_;
+        }
 
         virtual policies::scheduler_base* get_scheduler() const
         {
@@ -285,6 +294,25 @@ namespace hpx { namespace threads {
         {
             return 0;
         }
+        // add the durations of the thread phases executed by the given
+        // worker thread (all threads if thread_num == -1) to the given
+        // histogram counts (in timestamp units)
+        virtual void get_thread_phase_duration_histogram(
+            std::size_t /*thread_num*/,
+            util::log_linear_histogram::counts_type& /*counts*/,
+            bool /*reset*/)
+        {
+        }
+        std::int64_t get_thread_phase_duration_percentile(
+            std::size_t thread_num, double percentile, bool reset)
+        {
+            util::log_linear_histogram::counts_type counts;
+            get_thread_phase_duration_histogram(thread_num, counts, reset);
+            return std::int64_t(
+                double(util::log_linear_histogram::get_percentile(
+                    counts, percentile)) *
+                timestamp_scale_);
+        }
         virtual std::int64_t get_thread_duration(
             std::size_t /*thread_num*/, bool /*reset*/)
         {
@@ -431,6 +459,30 @@ namespace hpx { namespace threads {
         }
 #endif
 
+        virtual std::int64_t get_num_missed_deadlines(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_average_deadline_lateness(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_tenant_cpu_time(tenant_id /*tenant*/,
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_num_stolen_at_distance(
+            std::size_t /*thread_num*/, policies::steal_distance /*distance*/,
+            bool /*reset*/)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
             bool /*reset*/)
@@ -47,6 +47,7 @@ namespace hpx { namespace threads { namespace policies {
       , background_thread_count_(0)
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
+      , polling_function_io_(&null_polling_function)
     {
         set_scheduler_mode(mode);
 
@@ -107,6 +108,17 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+    void scheduler_base::create_threads_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
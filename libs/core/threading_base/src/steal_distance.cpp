@@ -0,0 +1,48 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace threads { namespace policies {
+
+    namespace detail {
+        static char const* const steal_distance_names[] = {
+            "core", "l2", "l3", "numa", "remote"};
+    }
+
+    char const* get_steal_distance_name(steal_distance distance) noexcept
+    {
+        std::size_t const index = static_cast<std::size_t>(distance);
+        if (index >= num_steal_distances)
+            return "unknown";
+        return detail::steal_distance_names[index];
+    }
+
+    steal_distance get_steal_distance(std::string const& name, error_code& ec)
+    {
+        for (std::size_t i = 0; i != num_steal_distances; ++i)
+        {
+            if (name == detail::steal_distance_names[i])
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return static_cast<steal_distance>(i);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "policies::get_steal_distance",
+            hpx::util::format("unknown steal distance '{}', valid values "
+                              "are: core, l2, l3, numa, remote",
+                name));
+        return steal_distance::core;
+    }
+}}}    // namespace hpx::threads::policies
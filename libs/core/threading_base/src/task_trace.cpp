@@ -0,0 +1,280 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/task_trace.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        struct task_trace_ring
+        {
+            explicit task_trace_ring(std::size_t capacity)
+              : events_(capacity)
+              , head_(0)
+            {
+            }
+
+            // only the owning worker thread writes events
+            void record(task_trace_event const& e) noexcept
+            {
+                std::uint64_t head = head_.load(std::memory_order_relaxed);
+                events_[head % events_.size()] = e;
+                head_.store(head + 1, std::memory_order_release);
+            }
+
+            // copy the events which are guaranteed not to be overwritten
+            // while they were copied
+            void snapshot(std::vector<task_trace_event>& events) const
+            {
+                std::uint64_t const capacity = events_.size();
+                std::uint64_t const head =
+                    head_.load(std::memory_order_acquire);
+                std::uint64_t const first =
+                    head > capacity ? head - capacity : 0;
+
+                std::vector<task_trace_event> copied;
+                copied.reserve(static_cast<std::size_t>(head - first));
+                for (std::uint64_t i = first; i != head; ++i)
+                {
+                    copied.push_back(events_[i % capacity]);
+                }
+
+                // the writer might have overwritten events (and might
+                // currently be writing the event at index new_head)
+                std::atomic_thread_fence(std::memory_order_acquire);
+                std::uint64_t const new_head =
+                    head_.load(std::memory_order_relaxed);
+                std::uint64_t const valid =
+                    new_head >= capacity ? new_head - capacity + 1 : 0;
+
+                std::size_t const skip = static_cast<std::size_t>(
+                    (std::min)(head, (std::max)(first, valid)) - first);
+                events.assign(copied.begin() + skip, copied.end());
+            }
+
+            std::vector<task_trace_event> events_;
+            std::atomic<std::uint64_t> head_;
+        };
+
+        struct task_trace_data
+        {
+            std::mutex mtx_;
+            std::vector<std::unique_ptr<task_trace_ring>> rings_;
+            std::string dump_filename_;
+
+            // used to convert hardware timestamps to microseconds
+            std::uint64_t start_timestamp_ = 0;
+            std::chrono::steady_clock::time_point start_time_;
+        };
+
+        task_trace_data& get_task_trace_data()
+        {
+            static task_trace_data data;
+            return data;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void print_json_string(std::ostream& os, std::string const& s)
+        {
+            os << '"';
+            for (char c : s)
+            {
+                switch (c)
+                {
+                case '"':
+                    os << "\\\"";
+                    break;
+                case '\\':
+                    os << "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                        os << ' ';
+                    else
+                        os << c;
+                    break;
+                }
+            }
+            os << '"';
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> task_trace::enabled_(false);
+    std::atomic<bool> task_trace::dump_requested_(false);
+
+    void task_trace::enable(std::size_t num_threads, std::size_t capacity,
+        std::string const& dump_filename)
+    {
+        if (capacity == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "task_trace::enable",
+                "the capacity of the task trace buffers must not be zero");
+        }
+
+        detail::task_trace_data& data = detail::get_task_trace_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        if (data.rings_.empty())
+        {
+            data.rings_.reserve(num_threads);
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                data.rings_.emplace_back(new detail::task_trace_ring(capacity));
+            }
+
+            data.start_timestamp_ = util::hardware::timestamp();
+            data.start_time_ = std::chrono::steady_clock::now();
+        }
+        data.dump_filename_ = dump_filename;
+
+        // publishes the ring buffers to the worker threads
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    void task_trace::disable() noexcept
+    {
+        enabled_.store(false, std::memory_order_release);
+    }
+
+    void task_trace::record(std::size_t global_thread_num,
+        thread_data const* thrd, std::uint64_t begin,
+        thread_state_enum state) noexcept
+    {
+        detail::task_trace_data& data = detail::get_task_trace_data();
+        if (global_thread_num >= data.rings_.size())
+            return;
+
+        task_trace_event e;
+        e.begin_ = begin;
+        e.end_ = util::hardware::timestamp();
+        e.id_ = thrd;
+        e.parent_id_ = get_thread_id_data(thrd->get_parent_thread_id());
+        e.description_ = thrd->get_description();
+        e.phase_ = thrd->get_thread_phase();
+        e.state_ = state;
+
+        data.rings_[global_thread_num]->record(e);
+    }
+
+    void task_trace::dump(std::string const& filename, error_code& ec)
+    {
+        detail::task_trace_data& data = detail::get_task_trace_data();
+        std::lock_guard<std::mutex> l(data.mtx_);
+
+        std::ofstream out(filename.c_str());
+        if (!out)
+        {
+            HPX_THROWS_IF(ec, filesystem_error, "task_trace::dump",
+                hpx::util::format(
+                    "could not open task trace file '{}'", filename));
+            return;
+        }
+
+        // calibrate the hardware timestamps against the steady clock
+        std::uint64_t const ticks =
+            util::hardware::timestamp() - data.start_timestamp_;
+        double const elapsed_us =
+            std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - data.start_time_)
+                .count();
+        double const scale =
+            ticks != 0 ? elapsed_us / static_cast<double>(ticks) : 1.0;
+
+        auto to_us = [&](std::uint64_t ts) {
+            return static_cast<double>(ts - data.start_timestamp_) * scale;
+        };
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        std::vector<task_trace_event> events;
+        for (std::size_t t = 0; t != data.rings_.size(); ++t)
+        {
+            out << (first ? "\n" : ",\n")
+                << hpx::util::format("{{\"name\":\"thread_name\",\"ph\":\"M\","
+                                     "\"pid\":0,\"tid\":{},\"args\":{{"
+                                     "\"name\":\"worker-thread#{}\"}}}}",
+                       t, t);
+            first = false;
+
+            data.rings_[t]->snapshot(events);
+            for (task_trace_event const& e : events)
+            {
+                // skip events recorded before the last calibration point
+                if (e.begin_ < data.start_timestamp_ || e.end_ < e.begin_)
+                    continue;
+
+                out << ",\n{\"name\":";
+                detail::print_json_string(
+                    out, util::as_string(e.description_));
+                out << hpx::util::format(
+                    ",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                    "\"dur\":{:.3f},\"pid\":0,\"tid\":{},\"args\":{{"
+                    "\"id\":\"{}\",\"parent\":\"{}\",\"phase\":{},"
+                    "\"exit\":\"{}\",\"state\":\"{}\"}}}}",
+                    e.phase_ <= 1 ? "begin" : "resume", to_us(e.begin_),
+                    to_us(e.end_) - to_us(e.begin_), t, e.id_, e.parent_id_,
+                    e.phase_, e.state_ == terminated ? "end" : "suspend",
+                    get_thread_state_name(e.state_));
+            }
+        }
+
+        out << "\n]}\n";
+
+        if (!out)
+        {
+            HPX_THROWS_IF(ec, filesystem_error, "task_trace::dump",
+                hpx::util::format(
+                    "could not write task trace file '{}'", filename));
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void task_trace::handle_dump_request()
+    {
+        if (!dump_requested_.exchange(false, std::memory_order_relaxed))
+            return;
+
+        std::string filename;
+        {
+            detail::task_trace_data& data = detail::get_task_trace_data();
+            std::lock_guard<std::mutex> l(data.mtx_);
+            filename = data.dump_filename_;
+        }
+
+        error_code ec(lightweight);
+        dump(filename, ec);
+        if (ec)
+        {
+            LERR_(error) << "task_trace::handle_dump_request: "
+                         << ec.get_message();
+        }
+    }
+}}    // namespace hpx::threads
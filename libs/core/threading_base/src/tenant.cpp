@@ -0,0 +1,194 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/threading_base/tenant.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace hpx { namespace threads {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        struct tenant_registry
+        {
+            tenant_registry()
+              : num_tenants_(1)
+            {
+                names_[default_tenant] = "default";
+                for (std::atomic<std::uint32_t>& weight : weights_)
+                {
+                    weight.store(1, std::memory_order_relaxed);
+                }
+            }
+
+            std::mutex mtx_;
+            std::string names_[max_tenants];
+
+            // the weights are read by the schedulers without locking
+            std::atomic<std::uint32_t> weights_[max_tenants];
+            std::atomic<std::size_t> num_tenants_;
+        };
+
+        tenant_registry& get_tenant_registry()
+        {
+            static tenant_registry registry;
+            return registry;
+        }
+
+        // the tenant set by the innermost scoped_tenant, -1 if none
+        std::int32_t& current_tenant_tss()
+        {
+            static thread_local std::int32_t current_tenant = -1;
+            return current_tenant;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    tenant_id register_tenant(
+        std::string const& name, std::uint32_t weight, error_code& ec)
+    {
+        if (weight == 0)
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "threads::register_tenant",
+                "the weight of a tenant must not be zero");
+            return default_tenant;
+        }
+
+        detail::tenant_registry& r = detail::get_tenant_registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+
+        std::size_t const num_tenants =
+            r.num_tenants_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != num_tenants; ++i)
+        {
+            if (r.names_[i] == name)
+            {
+                r.weights_[i].store(weight, std::memory_order_relaxed);
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return static_cast<tenant_id>(i);
+            }
+        }
+
+        if (num_tenants == max_tenants)
+        {
+            HPX_THROWS_IF(ec, out_of_memory, "threads::register_tenant",
+                hpx::util::format("can't register tenant '{}', the maximal "
+                                  "number of tenants ({}) was reached",
+                    name, max_tenants));
+            return default_tenant;
+        }
+
+        r.names_[num_tenants] = name;
+        r.weights_[num_tenants].store(weight, std::memory_order_relaxed);
+
+        // publish the new tenant
+        r.num_tenants_.store(num_tenants + 1, std::memory_order_release);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+        return static_cast<tenant_id>(num_tenants);
+    }
+
+    tenant_id get_tenant_id(std::string const& name, error_code& ec)
+    {
+        detail::tenant_registry& r = detail::get_tenant_registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+
+        std::size_t const num_tenants =
+            r.num_tenants_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != num_tenants; ++i)
+        {
+            if (r.names_[i] == name)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return static_cast<tenant_id>(i);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "threads::get_tenant_id",
+            hpx::util::format("unknown tenant '{}'", name));
+        return default_tenant;
+    }
+
+    std::string get_tenant_name(tenant_id tenant)
+    {
+        detail::tenant_registry& r = detail::get_tenant_registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+        if (tenant >= r.num_tenants_.load(std::memory_order_relaxed))
+            return std::string();
+        return r.names_[tenant];
+    }
+
+    std::uint32_t get_tenant_weight(tenant_id tenant) noexcept
+    {
+        if (tenant >= max_tenants)
+            return 1;
+        return detail::get_tenant_registry().weights_[tenant].load(
+            std::memory_order_relaxed);
+    }
+
+    void set_tenant_weight(
+        tenant_id tenant, std::uint32_t weight, error_code& ec)
+    {
+        detail::tenant_registry& r = detail::get_tenant_registry();
+        if (weight == 0 ||
+            tenant >= r.num_tenants_.load(std::memory_order_acquire))
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "threads::set_tenant_weight",
+                hpx::util::format(
+                    "invalid tenant ({}) or weight ({})", tenant, weight));
+            return;
+        }
+
+        r.weights_[tenant].store(weight, std::memory_order_relaxed);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    std::size_t get_num_tenants() noexcept
+    {
+        return detail::get_tenant_registry().num_tenants_.load(
+            std::memory_order_acquire);
+    }
+
+    tenant_id get_current_tenant() noexcept
+    {
+        std::int32_t const current = detail::current_tenant_tss();
+        if (current >= 0)
+            return static_cast<tenant_id>(current);
+
+        thread_self* self = get_self_ptr();
+        if (self != nullptr)
+            return get_self_id_data()->get_tenant();
+
+        return default_tenant;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    scoped_tenant::scoped_tenant(tenant_id tenant) noexcept
+      : previous_(detail::current_tenant_tss())
+    {
+        detail::current_tenant_tss() = tenant;
+    }
+
+    scoped_tenant::~scoped_tenant()
+    {
+        detail::current_tenant_tss() = previous_;
+    }
+}}    // namespace hpx::threads
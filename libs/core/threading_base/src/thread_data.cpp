@@ -63,6 +63,8 @@ namespace hpx { namespace threads {
       , backtrace_(nullptr)
 #endif
       , priority_(init_data.priority)
+      , deadline_(init_data.deadline)
+      , tenant_(init_data.tenant)
       , requested_interrupt_(false)
       , enabled_interrupt_(true)
       , ran_exit_funcs_(false)
@@ -199,6 +201,8 @@ namespace hpx { namespace threads {
         backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
+        deadline_ = init_data.deadline;
+        tenant_ = init_data.tenant;
         requested_interrupt_ = false;
         enabled_interrupt_ = true;
         ran_exit_funcs_ = false;
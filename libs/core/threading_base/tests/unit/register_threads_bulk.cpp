@@ -0,0 +1,87 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_threads_bulk(std::size_t num_tasks)
+{
+    std::atomic<std::size_t> count(0);
+    hpx::lcos::local::latch l(num_tasks + 1);
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // mix threads with and without hints and with different priorities
+        hpx::threads::thread_schedule_hint hint;
+        if (i % 3 == 0)
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i % num_threads));
+
+        hpx::threads::thread_priority priority =
+            i % 7 == 0 ? hpx::threads::thread_priority_high :
+                         hpx::threads::thread_priority_normal;
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&count, &l]() {
+                                  ++count;
+                                  l.count_down(1);
+                              }),
+            "test_register_threads_bulk", priority, hint);
+    }
+
+    hpx::threads::register_threads_bulk(data);
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_bulk_async_execute(std::size_t num_tasks)
+{
+    std::vector<std::size_t> shape(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        shape[i] = i;
+
+    hpx::execution::parallel_executor exec;
+    std::vector<hpx::future<std::size_t>> results =
+        hpx::parallel::execution::bulk_async_execute(
+            exec, [](std::size_t i) { return 2 * i; }, shape);
+
+    HPX_TEST_EQ(results.size(), num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        HPX_TEST_EQ(results[i].get(), 2 * i);
+}
+
+int hpx_main()
+{
+    for (std::size_t num_tasks : {0, 1, 3, 100, 10000})
+    {
+        test_register_threads_bulk(num_tasks);
+        test_bulk_async_execute(num_tasks);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,97 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/task_trace.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void traced_task()
+{
+    // suspend once to record a 'suspend' and a 'resume' event
+    hpx::this_thread::yield();
+}
+
+std::size_t count(std::string const& s, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + what.size()))
+    {
+        ++result;
+    }
+    return result;
+}
+
+int hpx_main()
+{
+    std::size_t const num_tasks = 100;
+    std::string const filename = "task_trace_test.json";
+
+    HPX_TEST(!hpx::threads::task_trace::enabled());
+
+    hpx::threads::task_trace::enable(hpx::get_os_thread_count(), 1024);
+    HPX_TEST(hpx::threads::task_trace::enabled());
+
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(hpx::async(
+                hpx::util::annotated_function(&traced_task, "traced_task")));
+        }
+        hpx::wait_all(tasks);
+    }
+
+    hpx::threads::task_trace::disable();
+    HPX_TEST(!hpx::threads::task_trace::enabled());
+
+    hpx::threads::task_trace::dump(filename);
+
+    std::string trace;
+    {
+        std::ifstream in(filename);
+        HPX_TEST(in.good());
+        trace.assign(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+    }
+    std::remove(filename.c_str());
+
+    HPX_TEST_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["),
+        std::size_t(0));
+
+    // one metadata event per worker thread
+    HPX_TEST_EQ(count(trace, "\"ph\":\"M\""), hpx::get_os_thread_count());
+
+    // every task has terminated once and was suspended at least once
+    HPX_TEST_LTE(num_tasks, count(trace, "\"exit\":\"end\""));
+    HPX_TEST_LTE(num_tasks, count(trace, "\"exit\":\"suspend\""));
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_LTE(2 * num_tasks, count(trace, "\"name\":\"traced_task\""));
+#endif
+#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
+    HPX_TEST_LTE(num_tasks, count(trace, "\"cat\":\"resume\""));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -196,6 +196,17 @@ namespace hpx { namespace threads {
         mask_cref_type get_thread_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the data cache of the given level
+        ///        (1 for L1, 2 for L2 etc.) with the given thread. The mask is
+        ///        empty if the machine has no such cache.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t level, error_code& ec = throws) const;
+
         /// \brief Use the given bit mask to set the affinity of the given
         ///        thread. Each set bit corresponds to a processing unit the
         ///        thread will be allowed to run on.
@@ -445,6 +445,45 @@ namespace hpx { namespace threads {
         return empty_mask;
     }    // }}}
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, std::size_t level, error_code& ec) const
+    {    // {{{
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        mask_type cache_affinity_mask = mask_type();
+        resize(cache_affinity_mask, get_number_of_pus());
+
+        hwloc_obj_t obj = nullptr;
+
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+
+            // find the data (or unified) cache of the given level which
+            // contains the processing unit
+            for (/**/; obj != nullptr; obj = obj->parent)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                bool is_cache = hwloc_obj_type_is_dcache(obj->type);
+#else
+                bool is_cache = obj->type == HWLOC_OBJ_CACHE &&
+                    obj->attr->cache.type != HWLOC_OBJ_CACHE_INSTRUCTION;
+#endif
+                if (is_cache && obj->attr->cache.depth == level)
+                    break;
+            }
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        if (obj)
+            extract_node_mask(obj, cache_affinity_mask);
+
+        return cache_affinity_mask;
+    }    // }}}
+
     ///////////////////////////////////////////////////////////////////////////
     void topology::set_thread_affinity_mask(
         mask_cref_type mask, error_code& ec) const
@@ -0,0 +1,78 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace actions { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execution time statistics of an action which is not a direct action,
+    // used to decide whether a received instance of it is executed directly
+    // on the thread which decoded the parcel (see the configuration setting
+    // hpx.parcel.adaptive_direct_actions).
+    struct adaptive_direct_execution_data
+    {
+        constexpr adaptive_direct_execution_data() noexcept
+          : average_(0)
+          , demoted_(false)
+        {
+        }
+
+        // exponentially weighted moving average of the execution times (ns)
+        std::atomic<std::uint64_t> average_;
+
+        // set once the action suspended or ran for much longer than allowed
+        // while being executed directly, it will never be executed directly
+        // again
+        std::atomic<bool> demoted_;
+    };
+
+    template <typename Action>
+    adaptive_direct_execution_data&
+    get_adaptive_direct_execution_data() noexcept
+    {
+        static adaptive_direct_execution_data data;
+        return data;
+    }
+
+    // Return the execution time threshold (in ns) below which actions are
+    // executed directly, zero if this is disabled.
+    HPX_EXPORT std::uint64_t get_adaptive_direct_execution_threshold();
+
+    // Decide whether the action the given statistics belong to is executed
+    // directly. This is never done on non-HPX threads.
+    HPX_EXPORT bool run_adaptive_direct_execution(
+        adaptive_direct_execution_data const& data);
+
+    // Measure the execution time of an action which is executed directly and
+    // demote the action if it suspended the current thread.
+    class adaptive_direct_execution_guard
+    {
+    public:
+        HPX_EXPORT explicit adaptive_direct_execution_guard(
+            adaptive_direct_execution_data& data);
+        HPX_EXPORT ~adaptive_direct_execution_guard();
+
+        adaptive_direct_execution_guard(
+            adaptive_direct_execution_guard const&) = delete;
+        adaptive_direct_execution_guard& operator=(
+            adaptive_direct_execution_guard const&) = delete;
+
+    private:
+        adaptive_direct_execution_data& data_;
+        std::uint64_t start_;
+        std::size_t phase_;
+    };
+}}}    // namespace hpx::actions::detail
+
+#endif
@@ -9,6 +9,7 @@
 
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions/adaptive_direct_execution.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
@@ -22,11 +23,13 @@
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/traits/action_decorate_continuation.hpp>
 #include <hpx/traits/action_schedule_thread.hpp>
+#include <hpx/type_support/always_void.hpp>
 
 #include <chrono>
 #include <exception>
 #include <memory>
 #include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace hpx {
@@ -252,5 +255,89 @@ namespace hpx { namespace applier { namespace detail {
             }
         }
     };
+
+#if defined(HPX_HAVE_NETWORKING)
+    ///////////////////////////////////////////////////////////////////////////
+    // Components which schedule the threads for their actions themselves
+    // are not bypassed by executing these actions directly.
+    template <typename Action, typename Enable = void>
+    struct has_component_schedule_thread : std::false_type
+    {
+    };
+
+    template <typename Action>
+    struct has_component_schedule_thread<Action,
+        typename util::always_void<decltype(
+            Action::component_type::schedule_thread(
+                std::declval<naming::address::address_type>(),
+                std::declval<naming::address::component_type>(),
+                std::declval<threads::thread_init_data&>()))>::type>
+      : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Used for actions received through a parcel. Actions which are not
+    // direct actions are executed directly on the thread which decoded the
+    // parcel if they were measured to be short and never suspended while
+    // doing so (see hpx.parcel.adaptive_direct_actions).
+    template <typename Action,
+        bool Adaptive = !Action::direct_execution::value &&
+            !has_component_schedule_thread<Action>::value>
+    struct apply_received_helper : apply_helper<Action>
+    {
+    };
+
+    template <typename Action>
+    struct apply_received_helper<Action, /*Adaptive=*/true>
+    {
+        template <typename... Ts>
+        static void call(threads::thread_init_data&& data,
+            naming::id_type const& target, naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            actions::detail::adaptive_direct_execution_data& stats =
+                actions::detail::get_adaptive_direct_execution_data<Action>();
+
+            if (actions::detail::run_adaptive_direct_execution(stats))
+            {
+                actions::detail::adaptive_direct_execution_guard guard(stats);
+                call_sync<Action>(lva, comptype, std::forward<Ts>(vs)...);
+            }
+            else
+            {
+                apply_helper<Action>::call(std::move(data), target, lva,
+                    comptype, priority, std::forward<Ts>(vs)...);
+            }
+        }
+
+        template <typename Continuation, typename... Ts>
+        static void call(threads::thread_init_data&& data, Continuation&& cont,
+            naming::id_type const& target, naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            actions::detail::adaptive_direct_execution_data& stats =
+                actions::detail::get_adaptive_direct_execution_data<Action>();
+
+            if (actions::detail::run_adaptive_direct_execution(stats))
+            {
+                // first decorate the continuation
+                traits::action_decorate_continuation<Action>::call(cont);
+
+                actions::detail::adaptive_direct_execution_guard guard(stats);
+                call_sync<Action>(std::forward<Continuation>(cont), lva,
+                    comptype, std::forward<Ts>(vs)...);
+            }
+            else
+            {
+                apply_helper<Action>::call(std::move(data),
+                    std::forward<Continuation>(cont), target, lva, comptype,
+                    priority, std::forward<Ts>(vs)...);
+            }
+        }
+    };
+#endif
 }}}    // namespace hpx::applier::detail
 #endif
@@ -186,9 +186,10 @@ namespace hpx { namespace actions {
         data.timer_data = hpx::util::external_timer::new_task(
             data.description, data.parent_locality_id, data.parent_id);
 #endif
-        applier::detail::apply_helper<typename base_type::derived_type>::call(
-            std::move(data), std::move(cont_), target, lva, comptype,
-            this->priority_, std::move(hpx::get<Is>(this->arguments_))...);
+        applier::detail::apply_received_helper<
+            typename base_type::derived_type>::call(std::move(data),
+            std::move(cont_), target, lva, comptype, this->priority_,
+            std::move(hpx::get<Is>(this->arguments_))...);
     }
 
     template <typename Action>
@@ -0,0 +1,88 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions/adaptive_direct_execution.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace actions { namespace detail {
+
+    // Actions which run for longer than this multiple of the threshold while
+    // being executed directly are demoted.
+    constexpr std::uint64_t adaptive_direct_execution_demotion_factor = 10;
+
+    std::uint64_t get_adaptive_direct_execution_threshold()
+    {
+        static std::uint64_t const threshold =
+            hpx::util::from_string<std::uint64_t>(
+                get_config_entry("hpx.parcel.adaptive_direct_actions", "0"),
+                std::uint64_t(0));
+        return threshold;
+    }
+
+    bool run_adaptive_direct_execution(
+        adaptive_direct_execution_data const& data)
+    {
+        std::uint64_t const threshold =
+            get_adaptive_direct_execution_threshold();
+        if (threshold == 0 || data.demoted_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        // a directly executed action must be able to suspend the current
+        // thread, which is how blocking actions are detected
+        if (threads::get_self_ptr() == nullptr ||
+            !this_thread::has_sufficient_stack_space())
+        {
+            return false;
+        }
+
+        return data.average_.load(std::memory_order_relaxed) < threshold;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_direct_execution_guard::adaptive_direct_execution_guard(
+        adaptive_direct_execution_data& data)
+      : data_(data)
+      , start_(hpx::chrono::high_resolution_clock::now())
+      , phase_(threads::get_self_id_data()->get_thread_phase())
+    {
+    }
+
+    adaptive_direct_execution_guard::~adaptive_direct_execution_guard()
+    {
+        std::uint64_t const elapsed =
+            hpx::chrono::high_resolution_clock::now() - start_;
+
+        // concurrent updates may get lost, which is fine for a heuristic
+        std::uint64_t const average =
+            data_.average_.load(std::memory_order_relaxed);
+        data_.average_.store(
+            average - average / 8 + elapsed / 8, std::memory_order_relaxed);
+
+        // the thread phase changes whenever the thread was suspended
+        if (phase_ != threads::get_self_id_data()->get_thread_phase() ||
+            elapsed >
+                adaptive_direct_execution_demotion_factor *
+                    get_adaptive_direct_execution_threshold())
+        {
+            data_.demoted_.store(true, std::memory_order_relaxed);
+        }
+    }
+}}}    // namespace hpx::actions::detail
+
+#endif
@@ -42,6 +42,10 @@ namespace hpx { namespace actions { namespace detail {
         HPX_EXPORT void fill_missing_typenames();
         HPX_EXPORT std::uint32_t try_get_id(std::string const& type_name) const;
         HPX_EXPORT std::vector<std::string> get_unassigned_typenames() const;
+        HPX_EXPORT std::vector<std::string> get_assigned_typenames() const;
+        HPX_EXPORT std::vector<std::string> get_inconsistent_typenames(
+            std::vector<std::string> const& type_names,
+            std::vector<std::uint32_t> const& ids) const;
 
         HPX_EXPORT static std::uint32_t get_id(std::string const& type_name);
         HPX_EXPORT static base_action* create(
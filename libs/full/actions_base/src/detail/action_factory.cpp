@@ -12,10 +12,12 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -129,6 +131,50 @@ namespace hpx { namespace actions { namespace detail {
         return result;
     }
 
+    // Returns the (sorted) type-names which already have an id assigned,
+    // e.g. preassigned using HPX_REGISTER_ACTION_ID.
+    std::vector<std::string> action_registry::get_assigned_typenames() const
+    {
+        std::vector<std::string> result;
+        result.reserve(typename_to_id_.size());
+
+        for (auto const& v : typename_to_id_)
+        {
+            result.push_back(v.first);
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // Returns all of the given type-names for which the given id does not
+    // match this registry. This is the case if the type-name is known under
+    // a different id or if the id is in use for a different type-name.
+    std::vector<std::string> action_registry::get_inconsistent_typenames(
+        std::vector<std::string> const& type_names,
+        std::vector<std::uint32_t> const& ids) const
+    {
+        HPX_ASSERT(type_names.size() == ids.size());
+
+        std::unordered_set<std::uint32_t> used_ids;
+        used_ids.reserve(typename_to_id_.size());
+        for (auto const& v : typename_to_id_)
+        {
+            used_ids.insert(v.second);
+        }
+
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i != type_names.size(); ++i)
+        {
+            std::uint32_t const id = try_get_id(type_names[i]);
+            if (id == invalid_id ? used_ids.count(ids[i]) != 0 : id != ids[i])
+            {
+                result.push_back(type_names[i]);
+            }
+        }
+        return result;
+    }
+
     std::uint32_t action_registry::get_id(std::string const& type_name)
     {
         std::uint32_t id = instance().try_get_id(type_name);
@@ -148,23 +194,11 @@ namespace hpx { namespace actions { namespace detail {
     {
         action_registry& this_ = instance();
 
-        if (id >= this_.cache_.size())
-        {
-            std::string msg("Unknown type descriptor " + std::to_string(id));
-#if defined(HPX_DEBUG)
-            if (name != nullptr)
-            {
-                msg += ", for typename " + *name;
-            }
-            msg += this_.collect_registered_typenames();
-#endif
-            HPX_THROW_EXCEPTION(
-                serialization_error, "action_registry::create", msg);
-            return nullptr;
-        }
-
-        ctor_t ctor = this_.cache_[id];
-        if (ctor == nullptr)    // -V108
+        // the ids are dense, thus this is a direct table lookup
+        ctor_t ctor = HPX_LIKELY(id < this_.cache_.size()) ?
+            this_.cache_[id] :
+            nullptr;
+        if (HPX_UNLIKELY(ctor == nullptr))    // -V108
         {
             std::string msg("Unknown type descriptor " + std::to_string(id));
 #if defined(HPX_DEBUG)
@@ -194,7 +228,7 @@ namespace hpx { namespace actions { namespace detail {
         if (id_ >= cache_.size())
         {
             cache_.resize(id_ + 1, nullptr);
-            cache_[id_] = nullptr;
+            cache_[id_] = ctor;
             return;
         }
 
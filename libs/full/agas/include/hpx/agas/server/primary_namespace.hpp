@@ -288,6 +288,10 @@ namespace hpx { namespace agas { namespace server {
             std::vector<hpx::tuple<std::int64_t, naming::gid_type,
                 naming::gid_type>> const& requests);
 
+        void increment_credits(
+            std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+                naming::gid_type>> const& requests);
+
         std::pair<naming::gid_type, naming::gid_type> allocate(
             std::uint64_t count);
 
@@ -341,6 +345,7 @@ namespace hpx { namespace agas { namespace server {
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit);
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credits);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid);
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid);
 #if defined(HPX_HAVE_NETWORKING)
@@ -401,6 +406,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::increment_credit_action,
     primary_namespace_increment_credit_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::increment_credits_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::resolve_gid_action)
 
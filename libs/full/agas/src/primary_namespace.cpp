@@ -57,6 +57,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::increment_credit_action,
     primary_namespace_increment_credit_action,
     hpx::actions::primary_namespace_increment_credit_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action,
+    hpx::actions::primary_namespace_increment_credits_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
@@ -560,6 +560,17 @@ namespace hpx { namespace agas { namespace server {
         return credits;
     }
 
+    void primary_namespace::increment_credits(
+        std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+            naming::gid_type>> const& requests)
+    {    // increment_credits implementation
+        for (auto const& req : requests)
+        {
+            increment_credit(hpx::get<0>(req), hpx::get<1>(req),
+                hpx::get<2>(req));
+        }
+    }
+
     std::vector<std::int64_t> primary_namespace::decrement_credit(
         std::vector<hpx::tuple<std::int64_t, naming::gid_type,
             naming::gid_type>> const& requests)
@@ -0,0 +1,93 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/async_io/async_io.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace io {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Asynchronously read up to \a size bytes at position \a offset of the
+    /// file \a fd into \a buffer.
+    ///
+    /// \returns A future to the number of bytes read. The buffer must stay
+    ///          alive until the future has become ready.
+    HPX_EXPORT hpx::future<std::size_t> read(
+        int fd, void* buffer, std::size_t size, std::uint64_t offset);
+
+    /// Asynchronously write \a size bytes from \a buffer at position
+    /// \a offset of the file \a fd.
+    ///
+    /// \returns A future to the number of bytes written. The buffer must
+    ///          stay alive until the future has become ready.
+    HPX_EXPORT hpx::future<std::size_t> write(
+        int fd, void const* buffer, std::size_t size, std::uint64_t offset);
+
+    /// Asynchronously flush the data of the file \a fd to the storage device
+    HPX_EXPORT hpx::future<void> fsync(int fd);
+
+    /// Asynchronously receive up to \a size bytes from the socket \a fd
+    HPX_EXPORT hpx::future<std::size_t> recv(
+        int fd, void* buffer, std::size_t size, int flags = 0);
+
+    /// Asynchronously send \a size bytes to the socket \a fd
+    HPX_EXPORT hpx::future<std::size_t> send(
+        int fd, void const* buffer, std::size_t size, int flags = 0);
+
+    /// Returns whether the operations above are currently submitted through
+    /// io_uring. This is the case after init has been called if the system
+    /// supports io_uring. Otherwise the operations are executed by the
+    /// threads of the I/O thread pool.
+    HPX_EXPORT bool uses_io_uring();
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // reap completed operations, called by the scheduling loop
+        HPX_EXPORT void poll();
+
+        HPX_EXPORT void register_polling(hpx::threads::thread_pool_base&);
+        HPX_EXPORT void unregister_polling(hpx::threads::thread_pool_base&);
+    }    // namespace detail
+
+    /// Set up the io_uring submission queue (with room for \a queue_depth
+    /// operations) and reap completed operations from the scheduling loop of
+    /// the given thread pool (the default pool if empty).
+    HPX_EXPORT void init(
+        std::string const& pool_name = "", std::size_t queue_depth = 256);
+
+    /// Stop using io_uring, waits for all outstanding operations
+    HPX_EXPORT void finalize(std::string const& pool_name = "");
+
+    ///////////////////////////////////////////////////////////////////////////
+    // RAII helper enabling io_uring for its lifetime
+    struct HPX_NODISCARD enable_user_polling
+    {
+        enable_user_polling(std::string const& pool_name = "",
+            std::size_t queue_depth = 256)
+          : pool_name_(pool_name)
+        {
+            io::init(pool_name, queue_depth);
+        }
+
+        ~enable_user_polling()
+        {
+            io::finalize(pool_name_);
+        }
+
+    private:
+        std::string pool_name_;
+    };
+}}    // namespace hpx::io
@@ -0,0 +1,675 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io/async_io.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define HPX_ASYNC_IO_HAVE_IO_URING
+#endif
+#endif
+#endif
+#endif
+
+namespace hpx { namespace io {
+
+    namespace detail {
+
+        std::exception_ptr make_io_error(int err, char const* func)
+        {
+            return HPX_GET_EXCEPTION(
+                hpx::filesystem_error, func, std::strerror(err));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // fallback: run the blocking system call on the I/O thread pool
+        hpx::future<std::size_t> run_blocking(
+            ssize_t (*f)(int, void*, std::size_t, std::uint64_t, int), int fd,
+            void* buffer, std::size_t size, std::uint64_t offset, int flags,
+            char const* func)
+        {
+            return hpx::threads::run_as_os_thread(
+                [=]() -> std::size_t {
+                    ssize_t n = f(fd, buffer, size, offset, flags);
+                    if (n < 0)
+                    {
+                        std::rethrow_exception(make_io_error(errno, func));
+                    }
+                    return static_cast<std::size_t>(n);
+                });
+        }
+
+        ssize_t blocking_read(int fd, void* buffer, std::size_t size,
+            std::uint64_t offset, int)
+        {
+            return ::pread(fd, buffer, size, static_cast<off_t>(offset));
+        }
+
+        ssize_t blocking_write(int fd, void* buffer, std::size_t size,
+            std::uint64_t offset, int)
+        {
+            return ::pwrite(fd, buffer, size, static_cast<off_t>(offset));
+        }
+
+        ssize_t blocking_recv(
+            int fd, void* buffer, std::size_t size, std::uint64_t, int flags)
+        {
+            return ::recv(fd, buffer, size, flags);
+        }
+
+        ssize_t blocking_send(
+            int fd, void* buffer, std::size_t size, std::uint64_t, int flags)
+        {
+            return ::send(fd, buffer, size, flags);
+        }
+
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        ///////////////////////////////////////////////////////////////////////
+        // An outstanding operation, the address of this object is passed as
+        // the user data of the submission queue entry and is handed back
+        // with the completion.
+        struct io_operation
+        {
+            explicit io_operation(char const* func)
+              : func_(func)
+            {
+                std::memset(&msg_, 0, sizeof(msg_));
+            }
+
+            virtual ~io_operation() = default;
+
+            // the result is either the number of transferred bytes or a
+            // negated error code
+            virtual void set_result(int result) = 0;
+
+            char const* func_;
+            iovec iov_;
+            msghdr msg_;
+        };
+
+        template <typename T>
+        struct io_operation_impl : io_operation
+        {
+            explicit io_operation_impl(char const* func)
+              : io_operation(func)
+            {
+            }
+
+            void set_result(int result) override
+            {
+                if (result < 0)
+                {
+                    promise_.set_exception(make_io_error(-result, func_));
+                }
+                else
+                {
+                    promise_.set_value(static_cast<std::size_t>(result));
+                }
+            }
+
+            hpx::lcos::local::promise<T> promise_;
+        };
+
+        template <>
+        struct io_operation_impl<void> : io_operation
+        {
+            explicit io_operation_impl(char const* func)
+              : io_operation(func)
+            {
+            }
+
+            void set_result(int result) override
+            {
+                if (result < 0)
+                {
+                    promise_.set_exception(make_io_error(-result, func_));
+                }
+                else
+                {
+                    promise_.set_value();
+                }
+            }
+
+            hpx::lcos::local::promise<void> promise_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A minimal io_uring instance driven by the raw system calls.
+        // Submitting threads fill in submission queue entries, the scheduling
+        // loop hands them to the kernel in batches and reaps completions
+        // without ever blocking.
+        class io_uring_queue
+        {
+        public:
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            explicit io_uring_queue(unsigned entries)
+            {
+                io_uring_params params;
+                std::memset(&params, 0, sizeof(params));
+
+                int fd = static_cast<int>(
+                    ::syscall(__NR_io_uring_setup, entries, &params));
+                if (fd < 0)
+                    return;    // io_uring is not available
+
+                sq_ring_size_ =
+                    params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                cq_ring_size_ = params.cq_off.cqes +
+                    params.cq_entries * sizeof(io_uring_cqe);
+                sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+
+                bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP);
+                if (single_mmap)
+                {
+                    sq_ring_size_ = cq_ring_size_ =
+                        (std::max)(sq_ring_size_, cq_ring_size_);
+                }
+
+                sq_ring_ = ::mmap(nullptr, sq_ring_size_,
+                    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                    IORING_OFF_SQ_RING);
+                if (sq_ring_ == MAP_FAILED)
+                {
+                    sq_ring_ = nullptr;
+                    ::close(fd);
+                    return;
+                }
+
+                if (single_mmap)
+                {
+                    cq_ring_ = sq_ring_;
+                }
+                else
+                {
+                    cq_ring_ = ::mmap(nullptr, cq_ring_size_,
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                        IORING_OFF_CQ_RING);
+                    if (cq_ring_ == MAP_FAILED)
+                    {
+                        cq_ring_ = nullptr;
+                        unmap();
+                        ::close(fd);
+                        return;
+                    }
+                }
+
+                void* sqes = ::mmap(nullptr, sqes_size_,
+                    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                    IORING_OFF_SQES);
+                if (sqes == MAP_FAILED)
+                {
+                    unmap();
+                    ::close(fd);
+                    return;
+                }
+                sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+                char* sq = static_cast<char*>(sq_ring_);
+                sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+                sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                sq_mask_ = *reinterpret_cast<unsigned*>(
+                    sq + params.sq_off.ring_mask);
+                sq_array_ =
+                    reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+                char* cq = static_cast<char*>(cq_ring_);
+                cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                cq_mask_ = *reinterpret_cast<unsigned*>(
+                    cq + params.cq_off.ring_mask);
+                cqes_ =
+                    reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+                sq_entries_ = params.sq_entries;
+                cq_entries_ = params.cq_entries;
+                fd_ = fd;
+            }
+
+            ~io_uring_queue()
+            {
+                if (fd_ >= 0)
+                {
+                    ::munmap(sqes_, sqes_size_);
+                    unmap();
+                    ::close(fd_);
+                }
+            }
+
+            io_uring_queue(io_uring_queue const&) = delete;
+            io_uring_queue& operator=(io_uring_queue const&) = delete;
+
+            bool valid() const noexcept
+            {
+                return fd_ >= 0;
+            }
+
+            std::size_t in_flight() const noexcept
+            {
+                return in_flight_.load(std::memory_order_acquire);
+            }
+
+            // Queue a new operation, returns false if the ring is full. The
+            // operation is handed to the kernel by the next call to poll().
+            bool submit(std::uint8_t opcode, int fd, void const* addr,
+                std::uint32_t len, std::uint64_t offset, std::uint32_t flags,
+                io_operation* op)
+            {
+                std::lock_guard<mutex_type> l(sq_mtx_);
+
+                // never have more operations in flight than the completion
+                // queue can hold, otherwise completions could get lost
+                if (in_flight_.load(std::memory_order_relaxed) >= cq_entries_)
+                    return false;
+
+                unsigned const tail = *sq_tail_;
+                if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) ==
+                    sq_entries_)
+                {
+                    return false;
+                }
+
+                unsigned const index = tail & sq_mask_;
+                io_uring_sqe& sqe = sqes_[index];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = opcode;
+                sqe.fd = fd;
+                sqe.addr = reinterpret_cast<std::uintptr_t>(addr);
+                sqe.len = len;
+                sqe.off = offset;
+                sqe.msg_flags = flags;
+                sqe.user_data = reinterpret_cast<std::uintptr_t>(op);
+
+                sq_array_[index] = index;
+                __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+                ++to_submit_;
+                in_flight_.fetch_add(1, std::memory_order_release);
+                return true;
+            }
+
+            void poll()
+            {
+                if (in_flight_.load(std::memory_order_acquire) == 0)
+                    return;
+
+                // hand all newly queued operations to the kernel
+                {
+                    std::unique_lock<mutex_type> l(sq_mtx_, std::try_to_lock);
+                    if (l.owns_lock() && to_submit_ != 0)
+                    {
+                        int submitted = static_cast<int>(::syscall(
+                            __NR_io_uring_enter, fd_, to_submit_, 0, 0,
+                            nullptr, 0));
+                        if (submitted > 0)
+                            to_submit_ -= static_cast<unsigned>(submitted);
+                    }
+                }
+
+                // reap completions, the operations are completed outside of
+                // the lock as this may run continuations
+                constexpr std::size_t batch_size = 64;
+                std::pair<io_operation*, int> completed[batch_size];
+
+                std::size_t count = 0;
+                do
+                {
+                    count = 0;
+                    {
+                        std::unique_lock<mutex_type> l(
+                            cq_mtx_, std::try_to_lock);
+                        if (!l.owns_lock())
+                            return;
+
+                        unsigned head = *cq_head_;
+                        unsigned const tail =
+                            __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+
+                        while (head != tail && count != batch_size)
+                        {
+                            io_uring_cqe const& cqe = cqes_[head & cq_mask_];
+                            completed[count++] = std::make_pair(
+                                reinterpret_cast<io_operation*>(
+                                    static_cast<std::uintptr_t>(
+                                        cqe.user_data)),
+                                cqe.res);
+                            ++head;
+                        }
+
+                        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+                    }
+
+                    in_flight_.fetch_sub(count, std::memory_order_release);
+
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        std::unique_ptr<io_operation> op(completed[i].first);
+                        op->set_result(completed[i].second);
+                    }
+                } while (count == batch_size);
+            }
+
+        private:
+            void unmap()
+            {
+                if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+                    ::munmap(cq_ring_, cq_ring_size_);
+                if (sq_ring_ != nullptr)
+                    ::munmap(sq_ring_, sq_ring_size_);
+                sq_ring_ = cq_ring_ = nullptr;
+            }
+
+            int fd_ = -1;
+
+            void* sq_ring_ = nullptr;
+            void* cq_ring_ = nullptr;
+            std::size_t sq_ring_size_ = 0;
+            std::size_t cq_ring_size_ = 0;
+            std::size_t sqes_size_ = 0;
+
+            // submission queue
+            mutex_type sq_mtx_;
+            unsigned* sq_head_ = nullptr;
+            unsigned* sq_tail_ = nullptr;
+            unsigned* sq_array_ = nullptr;
+            unsigned sq_mask_ = 0;
+            unsigned sq_entries_ = 0;
+            unsigned to_submit_ = 0;
+            io_uring_sqe* sqes_ = nullptr;
+
+            // completion queue
+            mutex_type cq_mtx_;
+            unsigned* cq_head_ = nullptr;
+            unsigned* cq_tail_ = nullptr;
+            unsigned cq_mask_ = 0;
+            unsigned cq_entries_ = 0;
+            io_uring_cqe* cqes_ = nullptr;
+
+            std::atomic<std::size_t> in_flight_{0};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The queue is created by the first call to init() and lives until
+        // the end of the program as the scheduling loop might still be
+        // polling it while finalize() is running.
+        std::atomic<io_uring_queue*> current_queue(nullptr);
+
+        std::unique_ptr<io_uring_queue>& get_queue_storage()
+        {
+            static std::unique_ptr<io_uring_queue> queue;
+            return queue;
+        }
+
+        io_uring_queue* get_queue() noexcept
+        {
+            return current_queue.load(std::memory_order_acquire);
+        }
+
+        template <typename T>
+        hpx::future<T> submit(std::uint8_t opcode, int fd, void const* addr,
+            std::uint32_t len, std::uint64_t offset, std::uint32_t flags,
+            std::unique_ptr<io_operation_impl<T>> op)
+        {
+            hpx::future<T> f = op->promise_.get_future();
+
+            io_uring_queue* queue = get_queue();
+            HPX_ASSERT(queue != nullptr);
+
+            if (!queue->submit(opcode, fd, addr, len, offset, flags, op.get()))
+            {
+                return hpx::future<T>();
+            }
+
+            // the operation is now owned by the ring
+            op.release();
+            return f;
+        }
+
+        hpx::future<std::size_t> submit_rw(std::uint8_t opcode, int fd,
+            void const* buffer, std::size_t size, std::uint64_t offset,
+            char const* func)
+        {
+            std::unique_ptr<io_operation_impl<std::size_t>> op(
+                new io_operation_impl<std::size_t>(func));
+            op->iov_.iov_base = const_cast<void*>(buffer);
+            op->iov_.iov_len = size;
+
+            iovec const* iov = &op->iov_;
+            return submit<std::size_t>(
+                opcode, fd, iov, 1, offset, 0, std::move(op));
+        }
+
+        hpx::future<std::size_t> submit_msg(std::uint8_t opcode, int fd,
+            void const* buffer, std::size_t size, int flags, char const* func)
+        {
+            std::unique_ptr<io_operation_impl<std::size_t>> op(
+                new io_operation_impl<std::size_t>(func));
+            op->iov_.iov_base = const_cast<void*>(buffer);
+            op->iov_.iov_len = size;
+            op->msg_.msg_iov = &op->iov_;
+            op->msg_.msg_iovlen = 1;
+
+            msghdr const* msg = &op->msg_;
+            return submit<std::size_t>(opcode, fd, msg, 1, 0,
+                static_cast<std::uint32_t>(flags), std::move(op));
+        }
+#endif
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool uses_io_uring()
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        return detail::get_queue() != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    hpx::future<std::size_t> read(
+        int fd, void* buffer, std::size_t size, std::uint64_t offset)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        if (detail::get_queue() != nullptr)
+        {
+            hpx::future<std::size_t> f = detail::submit_rw(IORING_OP_READV,
+                fd, buffer, size, offset, "hpx::io::read");
+            if (f.valid())
+                return f;
+        }
+#endif
+        return detail::run_blocking(&detail::blocking_read, fd, buffer, size,
+            offset, 0, "hpx::io::read");
+    }
+
+    hpx::future<std::size_t> write(
+        int fd, void const* buffer, std::size_t size, std::uint64_t offset)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        if (detail::get_queue() != nullptr)
+        {
+            hpx::future<std::size_t> f = detail::submit_rw(IORING_OP_WRITEV,
+                fd, buffer, size, offset, "hpx::io::write");
+            if (f.valid())
+                return f;
+        }
+#endif
+        return detail::run_blocking(&detail::blocking_write, fd,
+            const_cast<void*>(buffer), size, offset, 0, "hpx::io::write");
+    }
+
+    hpx::future<void> fsync(int fd)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        if (detail::get_queue() != nullptr)
+        {
+            std::unique_ptr<detail::io_operation_impl<void>> op(
+                new detail::io_operation_impl<void>("hpx::io::fsync"));
+
+            hpx::future<void> f = detail::submit<void>(
+                IORING_OP_FSYNC, fd, nullptr, 0, 0, 0, std::move(op));
+            if (f.valid())
+                return f;
+        }
+#endif
+        return hpx::threads::run_as_os_thread([fd]() {
+            if (::fsync(fd) != 0)
+            {
+                std::rethrow_exception(
+                    detail::make_io_error(errno, "hpx::io::fsync"));
+            }
+        });
+    }
+
+    hpx::future<std::size_t> recv(
+        int fd, void* buffer, std::size_t size, int flags)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        if (detail::get_queue() != nullptr)
+        {
+            hpx::future<std::size_t> f = detail::submit_msg(IORING_OP_RECVMSG,
+                fd, buffer, size, flags, "hpx::io::recv");
+            if (f.valid())
+                return f;
+        }
+#endif
+        return detail::run_blocking(&detail::blocking_recv, fd, buffer, size,
+            0, flags, "hpx::io::recv");
+    }
+
+    hpx::future<std::size_t> send(
+        int fd, void const* buffer, std::size_t size, int flags)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        if (detail::get_queue() != nullptr)
+        {
+            hpx::future<std::size_t> f = detail::submit_msg(IORING_OP_SENDMSG,
+                fd, buffer, size, flags, "hpx::io::send");
+            if (f.valid())
+                return f;
+        }
+#endif
+        return detail::run_blocking(&detail::blocking_send, fd,
+            const_cast<void*>(buffer), size, 0, flags, "hpx::io::send");
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void poll()
+        {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+            // keep reaping after finalize() has stopped new submissions, the
+            // queue is set up before polling is enabled
+            io_uring_queue* queue = get_queue_storage().get();
+            if (queue != nullptr)
+                queue->poll();
+#endif
+        }
+
+        void register_polling(hpx::threads::thread_pool_base& pool)
+        {
+            pool.get_scheduler()->set_io_polling_function(&detail::poll);
+        }
+
+        void unregister_polling(hpx::threads::thread_pool_base& pool)
+        {
+            pool.get_scheduler()->clear_io_polling_function();
+        }
+
+        hpx::threads::thread_pool_base& get_pool(std::string const& pool_name)
+        {
+            if (pool_name.empty())
+                return hpx::resource::get_thread_pool(0);
+            return hpx::resource::get_thread_pool(pool_name);
+        }
+    }    // namespace detail
+
+    void init(std::string const& pool_name, std::size_t queue_depth)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        std::unique_ptr<detail::io_uring_queue>& queue =
+            detail::get_queue_storage();
+        if (!queue)
+        {
+            queue.reset(new detail::io_uring_queue(
+                static_cast<unsigned>(queue_depth)));
+        }
+
+        // without io_uring all operations are run on the I/O thread pool
+        if (!queue->valid())
+            return;
+
+        detail::register_polling(detail::get_pool(pool_name));
+        detail::current_queue.store(queue.get(), std::memory_order_release);
+#else
+        HPX_UNUSED(pool_name);
+        HPX_UNUSED(queue_depth);
+#endif
+    }
+
+    void finalize(std::string const& pool_name)
+    {
+#if defined(HPX_ASYNC_IO_HAVE_IO_URING)
+        detail::io_uring_queue* queue = detail::get_queue();
+        if (queue == nullptr)
+            return;
+
+        // new operations are executed on the I/O thread pool from now on,
+        // the outstanding ones are still reaped by the scheduling loop
+        detail::current_queue.store(nullptr, std::memory_order_release);
+
+        if (hpx::threads::get_self_ptr() != nullptr)
+        {
+            hpx::util::yield_while(
+                [queue]() { return queue->in_flight() != 0; },
+                "hpx::io::finalize");
+        }
+        else
+        {
+            while (queue->in_flight() != 0)
+                queue->poll();
+        }
+
+        detail::unregister_polling(detail::get_pool(pool_name));
+#else
+        HPX_UNUSED(pool_name);
+#endif
+    }
+}}    // namespace hpx::io
@@ -0,0 +1,133 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares random 4KiB reads from a file submitted through
+// io_uring (hpx::io::read) with the same reads executed as blocking pread
+// calls on the I/O thread pool (hpx::threads::run_as_os_thread).
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/async_io/async_io.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/run_as.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <unistd.h>
+
+constexpr std::size_t block_size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Read>
+double measure(std::vector<std::uint64_t> const& offsets,
+    std::size_t concurrency, Read&& read)
+{
+    std::vector<char> buffers(concurrency * block_size);
+    std::vector<hpx::future<std::size_t>> reads(concurrency);
+
+    hpx::chrono::high_resolution_timer timer;
+
+    // keep up to 'concurrency' reads in flight at any time
+    for (std::size_t i = 0; i != offsets.size(); ++i)
+    {
+        std::size_t slot = i % concurrency;
+        if (reads[slot].valid())
+            reads[slot].get();
+        reads[slot] = read(&buffers[slot * block_size], offsets[i]);
+    }
+    hpx::wait_all(reads);
+
+    return timer.elapsed();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const file_size = vm["file-size"].as<std::size_t>() << 20;
+    std::size_t const num_reads = vm["reads"].as<std::size_t>();
+    std::size_t const concurrency = vm["concurrency"].as<std::size_t>();
+
+    std::FILE* file = std::tmpfile();
+    HPX_TEST(file != nullptr);
+    int fd = fileno(file);
+
+    {
+        std::vector<char> block(block_size, 'x');
+        for (std::size_t i = 0; i < file_size; i += block_size)
+        {
+            HPX_TEST_EQ(::pwrite(fd, block.data(), block_size, off_t(i)),
+                ssize_t(block_size));
+        }
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(
+        0, file_size / block_size - 1);
+
+    std::vector<std::uint64_t> offsets(num_reads);
+    for (auto& offset : offsets)
+        offset = dist(gen) * block_size;
+
+    double const os_thread_time =
+        measure(offsets, concurrency, [fd](char* buffer, std::uint64_t off) {
+            return hpx::threads::run_as_os_thread([=]() {
+                return std::size_t(::pread(fd, buffer, block_size, off_t(off)));
+            });
+        });
+
+    double io_uring_time = 0;
+    bool uses_io_uring = false;
+    {
+        hpx::io::enable_user_polling enable("", concurrency);
+        uses_io_uring = hpx::io::uses_io_uring();
+
+        io_uring_time = measure(
+            offsets, concurrency, [fd](char* buffer, std::uint64_t off) {
+                return hpx::io::read(fd, buffer, block_size, off);
+            });
+    }
+
+    std::fclose(file);
+
+    std::cout << "reads, concurrency, io_uring, run_as_os_thread [s], "
+                 "hpx::io::read [s]"
+              << std::endl;
+    std::cout << num_reads << ", " << concurrency << ", " << uses_io_uring
+              << ", " << os_thread_time << ", " << io_uring_time << std::endl;
+
+    hpx::util::print_cdash_timing("RandomReadsOSThread", os_thread_time);
+    hpx::util::print_cdash_timing("RandomReadsIO", io_uring_time);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("file-size",
+         hpx::program_options::value<std::size_t>()->default_value(64),
+         "size of the file to read from [MiB]")
+        ("reads",
+         hpx::program_options::value<std::size_t>()->default_value(100000),
+         "number of random 4KiB reads")
+        ("concurrency",
+         hpx::program_options::value<std::size_t>()->default_value(64),
+         "number of reads in flight at any time");
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
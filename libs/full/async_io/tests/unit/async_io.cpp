@@ -0,0 +1,129 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/async_io/async_io.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_file_io()
+{
+    std::FILE* file = std::tmpfile();
+    HPX_TEST(file != nullptr);
+    int fd = fileno(file);
+
+    constexpr std::size_t block_size = 4096;
+    constexpr std::size_t num_blocks = 64;
+
+    std::vector<char> data(block_size * num_blocks);
+    std::iota(data.begin(), data.end(), char(0));
+
+    // write all blocks concurrently
+    std::vector<hpx::future<std::size_t>> writes;
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        writes.push_back(hpx::io::write(
+            fd, &data[i * block_size], block_size, i * block_size));
+    }
+    for (auto& f : writes)
+    {
+        HPX_TEST_EQ(f.get(), block_size);
+    }
+
+    hpx::io::fsync(fd).get();
+
+    // read them back in reverse order
+    std::vector<char> result(data.size(), 0);
+    std::vector<hpx::future<std::size_t>> reads;
+    for (std::size_t i = num_blocks; i != 0; --i)
+    {
+        std::uint64_t offset = (i - 1) * block_size;
+        reads.push_back(
+            hpx::io::read(fd, &result[offset], block_size, offset));
+    }
+    for (auto& f : reads)
+    {
+        HPX_TEST_EQ(f.get(), block_size);
+    }
+    HPX_TEST(data == result);
+
+    // reading past the end of the file returns zero bytes
+    HPX_TEST_EQ(
+        hpx::io::read(fd, result.data(), block_size, data.size()).get(),
+        std::size_t(0));
+
+    std::fclose(file);
+}
+
+void test_socket_io()
+{
+    int fds[2];
+    HPX_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    std::string const message("hello io");
+    std::vector<char> buffer(message.size());
+
+    hpx::future<std::size_t> received =
+        hpx::io::recv(fds[1], buffer.data(), buffer.size(), MSG_WAITALL);
+    HPX_TEST_EQ(hpx::io::send(fds[0], message.data(), message.size()).get(),
+        message.size());
+
+    HPX_TEST_EQ(received.get(), message.size());
+    HPX_TEST(std::string(buffer.begin(), buffer.end()) == message);
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+void test_errors()
+{
+    char buffer[16];
+    bool caught = false;
+    try
+    {
+        hpx::io::read(-1, buffer, sizeof(buffer), 0).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // without polling all operations run on the I/O thread pool
+    HPX_TEST(!hpx::io::uses_io_uring());
+    test_file_io();
+    test_socket_io();
+    test_errors();
+
+    {
+        hpx::io::enable_user_polling enable;
+
+        test_file_io();
+        test_socket_io();
+        test_errors();
+    }
+    HPX_TEST(!hpx::io::uses_io_uring());
+
+    return hpx::util::report_errors();
+}
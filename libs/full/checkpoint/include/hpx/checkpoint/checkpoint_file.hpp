@@ -0,0 +1,349 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the checkpoint_file_writer and checkpoint_file_reader
+/// classes. In contrast to save_checkpoint, which serializes all objects
+/// into one in-memory buffer, the checkpoint_file_writer streams the
+/// serialized data directly into files in blocks of a fixed size while the
+/// objects are being serialized. Each participant (by default each locality)
+/// writes its own shard, the shards of all participants are written in
+/// parallel.
+///
+/// Checkpoints are numbered by epochs. Incremental checkpoints write only
+/// those blocks whose hash has changed since the previous epoch, unchanged
+/// blocks are referred to in the files of the epoch that wrote them last.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    class checkpoint_file_writer;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Describes where the data of one block of a checkpoint is stored
+        struct checkpoint_file_block
+        {
+            std::uint64_t epoch_;     // epoch whose data file holds the block
+            std::uint64_t offset_;    // offset of the block in that file
+            std::uint64_t size_;
+            std::uint64_t hash_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & epoch_ & offset_ & size_ & hash_;
+                // clang-format on
+            }
+        };
+
+        // The index of one epoch of a checkpoint
+        struct checkpoint_file_index
+        {
+            std::uint64_t epoch_;
+            std::uint64_t size_;
+            std::vector<checkpoint_file_block> blocks_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & epoch_ & size_ & blocks_;
+                // clang-format on
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The container the serialization archive writes to, it collects the
+        // serialized data into blocks and hands every completed block to the
+        // writer.
+        class checkpoint_file_sink
+        {
+        public:
+            checkpoint_file_sink(
+                checkpoint_file_writer& writer, std::size_t block_size)
+              : writer_(writer)
+              , block_size_(block_size)
+              , size_(0)
+            {
+                block_.reserve(block_size_);
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t count) noexcept
+            {
+                size_ += count;
+            }
+
+            inline void append(void const* address, std::size_t count);
+
+            // hand the last (partial) block to the writer
+            inline void flush();
+
+        private:
+            checkpoint_file_writer& writer_;
+            std::size_t block_size_;
+            std::size_t size_;
+            std::vector<char> block_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The checkpoint_file_writer streams checkpoints of a set of objects into
+    /// files. The files of epoch \a e of participant \a rank are named
+    /// '<base_name>.<rank>.<e>.data' and '<base_name>.<rank>.<e>.index', the
+    /// last completed epoch is recorded in '<base_name>.<rank>.latest'.
+    ///
+    /// The objects are serialized into blocks of \a block_size bytes, each
+    /// completed block is written by the I/O thread pool while the
+    /// serialization of the next block continues. At most
+    /// \a max_pending_blocks blocks are kept in memory at any time.
+    ///
+    /// If \a incremental is true, blocks with the same hash as the block at
+    /// the same position of the previous epoch are not written again. A
+    /// writer created for a base name and rank which already has completed
+    /// epochs continues with the next epoch.
+    class HPX_EXPORT checkpoint_file_writer
+    {
+    public:
+        static constexpr std::size_t default_block_size = 1024 * 1024;
+        static constexpr std::size_t default_max_pending_blocks = 8;
+
+        /// Create a writer for the shard of this locality
+        explicit checkpoint_file_writer(std::string const& base_name);
+
+        /// Create a writer for the shard \a rank
+        checkpoint_file_writer(std::string const& base_name, std::size_t rank,
+            std::size_t block_size = default_block_size,
+            std::size_t max_pending_blocks = default_max_pending_blocks,
+            bool incremental = true);
+
+        checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer& operator=(
+            checkpoint_file_writer const&) = delete;
+
+        ~checkpoint_file_writer();
+
+        /// Asynchronously write the next epoch of the checkpoint, consisting
+        /// of the given objects.
+        ///
+        /// \param ts   The objects to checkpoint, they must not be modified
+        ///             (and must stay alive) until the returned future has
+        ///             become ready.
+        ///
+        /// \returns A future to the number of the written epoch. A writer
+        ///          supports only one save operation at a time.
+        template <typename... Ts>
+        hpx::future<std::uint64_t> save(Ts const&... ts)
+        {
+            begin_epoch();
+            return hpx::async([this, &ts...]() -> std::uint64_t {
+                try
+                {
+                    detail::checkpoint_file_sink sink(*this, block_size_);
+                    save_checkpoint_data(sink, ts...);
+                    sink.flush();
+                }
+                catch (...)
+                {
+                    abort_epoch();
+                    throw;
+                }
+                return end_epoch();
+            });
+        }
+
+        /// Return the number of the last completed epoch (zero if there is
+        /// none)
+        std::uint64_t get_epoch() const noexcept
+        {
+            return epoch_;
+        }
+
+        /// Return the number of bytes written to the data file by the last
+        /// completed epoch
+        std::uint64_t get_bytes_written() const noexcept
+        {
+            return bytes_written_;
+        }
+
+        /// Return the number of blocks of the last completed epoch which were
+        /// not written again as they did not change
+        std::size_t get_blocks_reused() const noexcept
+        {
+            return blocks_reused_;
+        }
+
+        /// \cond NOINTERNAL
+        // called by the sink for each completed block
+        void write_block(std::vector<char>&& block);
+        /// \endcond
+
+    private:
+        void begin_epoch();
+        std::uint64_t end_epoch();
+        void abort_epoch();
+
+        std::string base_name_;
+        std::size_t rank_;
+        std::size_t block_size_;
+        std::size_t max_pending_blocks_;
+        bool incremental_;
+
+        // the last completed epoch
+        std::uint64_t epoch_;
+        std::vector<detail::checkpoint_file_block> blocks_;
+        std::uint64_t bytes_written_;
+        std::size_t blocks_reused_;
+
+        // the epoch currently being written
+        std::atomic<bool> busy_;
+        std::ofstream file_;
+        std::uint64_t file_offset_;
+        std::vector<detail::checkpoint_file_block> current_blocks_;
+        std::size_t current_reused_;
+        hpx::future<void> last_write_;
+        std::atomic<std::size_t> pending_writes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The checkpoint_file_reader restores objects from the checkpoint files
+    /// written by a checkpoint_file_writer with the same base name and rank.
+    /// The blocks of an epoch are read in parallel.
+    class HPX_EXPORT checkpoint_file_reader
+    {
+    public:
+        /// Create a reader for the shard of this locality
+        explicit checkpoint_file_reader(std::string const& base_name);
+
+        /// Create a reader for the shard \a rank
+        checkpoint_file_reader(std::string const& base_name, std::size_t rank);
+
+        /// Return the number of the last completed epoch (zero if there is
+        /// none)
+        std::uint64_t get_latest_epoch() const;
+
+        /// Asynchronously restore the given objects from the checkpoint of
+        /// the given epoch. The objects have to be given in the same order as
+        /// they were passed to checkpoint_file_writer::save.
+        ///
+        /// \param epoch  The epoch to restore
+        /// \param ts     The objects to restore, they must stay alive until
+        ///               the returned future has become ready.
+        template <typename... Ts>
+        hpx::future<void> restore(std::uint64_t epoch, Ts&... ts) const
+        {
+            return hpx::async([this, epoch, &ts...]() {
+                std::vector<char> data = load(epoch);
+                restore_checkpoint_data(data, ts...);
+            });
+        }
+
+        /// Read the data of the given epoch, the blocks are read in parallel
+        std::vector<char> load(std::uint64_t epoch) const;
+
+    private:
+        std::string base_name_;
+        std::size_t rank_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void checkpoint_file_sink::append(
+            void const* address, std::size_t count)
+        {
+            char const* data = static_cast<char const*>(address);
+            while (count != 0)
+            {
+                std::size_t n = (std::min)(count, block_size_ - block_.size());
+                block_.insert(block_.end(), data, data + n);
+                data += n;
+                count -= n;
+
+                if (block_.size() == block_size_)
+                {
+                    writer_.write_block(std::move(block_));
+                    block_ = std::vector<char>();
+                    block_.reserve(block_size_);
+                }
+            }
+        }
+
+        void checkpoint_file_sink::flush()
+        {
+            if (!block_.empty())
+            {
+                writer_.write_block(std::move(block_));
+                block_ = std::vector<char>();
+            }
+        }
+    }    // namespace detail
+}}       // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_file_sink>
+      : default_serialization_access_data<util::detail::checkpoint_file_sink>
+    {
+        using sink_type = util::detail::checkpoint_file_sink;
+
+        static std::size_t size(sink_type const& sink)
+        {
+            return sink.size();
+        }
+
+        static void resize(sink_type& sink, std::size_t count)
+        {
+            sink.resize(count);
+        }
+
+        // the archive writes sequentially
+        static void write(sink_type& sink, std::size_t count,
+            std::size_t /* current */, void const* address)
+        {
+            sink.append(address, count);
+        }
+    };
+}}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
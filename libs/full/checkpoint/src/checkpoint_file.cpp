@@ -0,0 +1,380 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        std::string checkpoint_file_name(std::string const& base_name,
+            std::size_t rank, std::uint64_t epoch, char const* suffix)
+        {
+            return hpx::util::format(
+                "{}.{}.{}.{}", base_name, rank, epoch, suffix);
+        }
+
+        std::string checkpoint_latest_name(
+            std::string const& base_name, std::size_t rank)
+        {
+            return hpx::util::format("{}.{}.latest", base_name, rank);
+        }
+
+        // 64 bit hash of a block, processes the data in words of 8 bytes
+        std::uint64_t checkpoint_block_hash(char const* data, std::size_t size)
+        {
+            std::uint64_t const prime = 0x9e3779b97f4a7c15ULL;
+            std::uint64_t h = 0xcbf29ce484222325ULL ^ (size * prime);
+
+            std::size_t i = 0;
+            for (/**/; i + sizeof(std::uint64_t) <= size;
+                 i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(std::uint64_t));
+                h = (h ^ word) * prime;
+                h ^= h >> 29;
+            }
+            for (/**/; i != size; ++i)
+            {
+                h = (h ^ static_cast<unsigned char>(data[i])) * prime;
+                h ^= h >> 29;
+            }
+            return h;
+        }
+
+        std::uint64_t read_latest_epoch(
+            std::string const& base_name, std::size_t rank)
+        {
+            std::ifstream latest(checkpoint_latest_name(base_name, rank));
+
+            std::uint64_t epoch = 0;
+            if (!(latest >> epoch))
+                return 0;
+            return epoch;
+        }
+
+        checkpoint_file_index read_index(
+            std::string const& base_name, std::size_t rank, std::uint64_t epoch)
+        {
+            std::string const name =
+                checkpoint_file_name(base_name, rank, epoch, "index");
+
+            std::ifstream file(name, std::ios::binary);
+            std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                std::istreambuf_iterator<char>());
+            if (!file.good() && !file.eof())
+            {
+                HPX_THROW_EXCEPTION(filesystem_error, "detail::read_index",
+                    "unable to read checkpoint index: " + name);
+            }
+
+            if (data.empty())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, "detail::read_index",
+                    "checkpoint index does not exist: " + name);
+            }
+
+            checkpoint_file_index index;
+            restore_checkpoint_data(data, index);
+            return index;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_writer::checkpoint_file_writer(std::string const& base_name)
+      : checkpoint_file_writer(base_name, get_locality_id())
+    {
+    }
+
+    checkpoint_file_writer::checkpoint_file_writer(std::string const& base_name,
+        std::size_t rank, std::size_t block_size,
+        std::size_t max_pending_blocks, bool incremental)
+      : base_name_(base_name)
+      , rank_(rank)
+      , block_size_(block_size)
+      , max_pending_blocks_(max_pending_blocks)
+      , incremental_(incremental)
+      , epoch_(detail::read_latest_epoch(base_name, rank))
+      , bytes_written_(0)
+      , blocks_reused_(0)
+      , busy_(false)
+      , file_offset_(0)
+      , current_reused_(0)
+      , pending_writes_(0)
+    {
+        if (block_size_ == 0 || max_pending_blocks_ == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_file_writer::checkpoint_file_writer",
+                "the block size and the number of pending blocks must be "
+                "larger than zero");
+        }
+
+        // continue incrementally from the last completed epoch
+        if (epoch_ != 0 && incremental_)
+        {
+            blocks_ = detail::read_index(base_name_, rank_, epoch_).blocks_;
+        }
+    }
+
+    checkpoint_file_writer::~checkpoint_file_writer()
+    {
+        HPX_ASSERT(!busy_);
+    }
+
+    void checkpoint_file_writer::begin_epoch()
+    {
+        bool expected = false;
+        if (!busy_.compare_exchange_strong(expected, true))
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "checkpoint_file_writer::save",
+                "the previous checkpoint has not been completed yet");
+        }
+
+        std::string const name = detail::checkpoint_file_name(
+            base_name_, rank_, epoch_ + 1, "data");
+
+        file_.open(name, std::ios::binary | std::ios::trunc);
+        if (!file_.is_open())
+        {
+            busy_ = false;
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file_writer::save",
+                "unable to create checkpoint file: " + name);
+        }
+
+        file_offset_ = 0;
+        current_blocks_.clear();
+        current_reused_ = 0;
+        last_write_ = hpx::make_ready_future();
+        pending_writes_ = 0;
+    }
+
+    void checkpoint_file_writer::write_block(std::vector<char>&& block)
+    {
+        std::size_t const pos = current_blocks_.size();
+
+        detail::checkpoint_file_block b;
+        b.epoch_ = epoch_ + 1;
+        b.offset_ = file_offset_;
+        b.size_ = block.size();
+        b.hash_ = detail::checkpoint_block_hash(block.data(), block.size());
+
+        // refer to the previous copy of unchanged blocks
+        if (incremental_ && pos < blocks_.size() &&
+            blocks_[pos].size_ == b.size_ && blocks_[pos].hash_ == b.hash_)
+        {
+            current_blocks_.push_back(blocks_[pos]);
+            ++current_reused_;
+            return;
+        }
+
+        current_blocks_.push_back(b);
+        file_offset_ += b.size_;
+
+        // limit the amount of memory held by blocks waiting to be written
+        hpx::util::yield_while(
+            [this]() { return pending_writes_ >= max_pending_blocks_; },
+            "checkpoint_file_writer::write_block");
+
+        // the blocks are written in order by the I/O thread pool
+        ++pending_writes_;
+        std::shared_ptr<std::vector<char>> data =
+            std::make_shared<std::vector<char>>(std::move(block));
+
+        last_write_ = last_write_.then(hpx::launch::async,
+            [this, data = std::move(data)](hpx::future<void>&& f) {
+                try
+                {
+                    f.get();
+                    hpx::threads::run_as_os_thread([this, &data]() {
+                        file_.write(data->data(), data->size());
+                    }).get();
+                }
+                catch (...)
+                {
+                    --pending_writes_;
+                    throw;
+                }
+                --pending_writes_;
+
+                if (!file_.good())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::write_block",
+                        "unable to write checkpoint data");
+                }
+            });
+    }
+
+    std::uint64_t checkpoint_file_writer::end_epoch()
+    {
+        std::uint64_t const epoch = epoch_ + 1;
+        try
+        {
+            last_write_.get();
+
+            hpx::threads::run_as_os_thread([this]() { file_.close(); }).get();
+            if (file_.fail())
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_file_writer::save",
+                    "unable to write checkpoint data");
+            }
+
+            detail::checkpoint_file_index index;
+            index.epoch_ = epoch;
+            index.size_ = 0;
+            for (detail::checkpoint_file_block const& b : current_blocks_)
+                index.size_ += b.size_;
+            index.blocks_ = std::move(current_blocks_);
+
+            std::vector<char> data;
+            save_checkpoint_data(data, index);
+
+            hpx::threads::run_as_os_thread([&]() {
+                std::string const name = detail::checkpoint_file_name(
+                    base_name_, rank_, epoch, "index");
+                std::ofstream file(name, std::ios::binary | std::ios::trunc);
+                file.write(data.data(), data.size());
+                file.close();
+
+                // record the epoch as completed only after its index was
+                // written
+                std::ofstream latest(
+                    detail::checkpoint_latest_name(base_name_, rank_),
+                    std::ios::trunc);
+                latest << epoch;
+                latest.close();
+
+                if (file.fail() || latest.fail())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::save",
+                        "unable to write checkpoint index: " + name);
+                }
+            }).get();
+
+            epoch_ = epoch;
+            blocks_ = std::move(index.blocks_);
+            bytes_written_ = file_offset_;
+            blocks_reused_ = current_reused_;
+        }
+        catch (...)
+        {
+            abort_epoch();
+            throw;
+        }
+
+        busy_ = false;
+        return epoch;
+    }
+
+    void checkpoint_file_writer::abort_epoch()
+    {
+        // wait for all outstanding writes before releasing the file
+        if (last_write_.valid())
+            last_write_.wait();
+        last_write_ = hpx::future<void>();
+
+        if (file_.is_open())
+            file_.close();
+        current_blocks_.clear();
+
+        busy_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_reader::checkpoint_file_reader(std::string const& base_name)
+      : checkpoint_file_reader(base_name, get_locality_id())
+    {
+    }
+
+    checkpoint_file_reader::checkpoint_file_reader(
+        std::string const& base_name, std::size_t rank)
+      : base_name_(base_name)
+      , rank_(rank)
+    {
+    }
+
+    std::uint64_t checkpoint_file_reader::get_latest_epoch() const
+    {
+        return detail::read_latest_epoch(base_name_, rank_);
+    }
+
+    std::vector<char> checkpoint_file_reader::load(std::uint64_t epoch) const
+    {
+        detail::checkpoint_file_index index =
+            detail::read_index(base_name_, rank_, epoch);
+
+        std::vector<char> data(index.size_);
+
+        // read all blocks in parallel, each read uses its own stream
+        std::vector<hpx::future<void>> reads;
+        reads.reserve(index.blocks_.size());
+
+        std::size_t pos = 0;
+        for (detail::checkpoint_file_block const& b : index.blocks_)
+        {
+            char* dest = data.data() + pos;
+            pos += b.size_;
+
+            reads.push_back(hpx::threads::run_as_os_thread([this, dest, b]() {
+                std::string const name = detail::checkpoint_file_name(
+                    base_name_, rank_, b.epoch_, "data");
+
+                std::ifstream file(name, std::ios::binary);
+                file.seekg(static_cast<std::streamoff>(b.offset_));
+                file.read(dest, static_cast<std::streamsize>(b.size_));
+                if (!file.good())
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_reader::load",
+                        "unable to read checkpoint data: " + name);
+                }
+
+                if (detail::checkpoint_block_hash(dest, b.size_) != b.hash_)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_reader::load",
+                        "corrupted checkpoint data: " + name);
+                }
+            }));
+        }
+
+        hpx::wait_all(reads);
+        for (hpx::future<void>& f : reads)
+            f.get();
+
+        return data;
+    }
+}}    // namespace hpx::util
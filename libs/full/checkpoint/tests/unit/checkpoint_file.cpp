@@ -0,0 +1,105 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This tests the streaming checkpoint_file_writer and checkpoint_file_reader,
+// including incremental epochs.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file_reader;
+using hpx::util::checkpoint_file_writer;
+
+std::string const base_name = "checkpoint_file_test";
+
+void remove_files(std::size_t rank, std::uint64_t epochs)
+{
+    for (std::uint64_t epoch = 1; epoch <= epochs; ++epoch)
+    {
+        std::remove(hpx::util::format(
+            "{}.{}.{}.data", base_name, rank, epoch).c_str());
+        std::remove(hpx::util::format(
+            "{}.{}.{}.index", base_name, rank, epoch).c_str());
+    }
+    std::remove(hpx::util::format("{}.{}.latest", base_name, rank).c_str());
+}
+
+int main()
+{
+    std::size_t const rank = 0;
+    std::size_t const block_size = 4096;
+    remove_files(rank, 3);
+
+    std::string str = "I am a string of characters";
+    std::vector<double> values(100000);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = double(i);
+
+    {
+        checkpoint_file_writer writer(base_name, rank, block_size, 4);
+        HPX_TEST_EQ(writer.get_epoch(), std::uint64_t(0));
+
+        // the first epoch writes all blocks
+        HPX_TEST_EQ(writer.save(str, values).get(), std::uint64_t(1));
+        HPX_TEST_EQ(writer.get_blocks_reused(), std::size_t(0));
+        std::uint64_t full_size = writer.get_bytes_written();
+        HPX_TEST_LT(std::uint64_t(values.size() * sizeof(double)),
+            full_size + 1);
+
+        // the second epoch writes only the changed block
+        values[values.size() / 2] = -1.0;
+        HPX_TEST_EQ(writer.save(str, values).get(), std::uint64_t(2));
+        HPX_TEST_LT(std::size_t(0), writer.get_blocks_reused());
+        HPX_TEST_LT(writer.get_bytes_written(), std::uint64_t(2 * block_size));
+    }
+
+    // a new writer continues with the next epoch, unchanged data is not
+    // written again
+    {
+        checkpoint_file_writer writer(base_name, rank, block_size, 4);
+        HPX_TEST_EQ(writer.get_epoch(), std::uint64_t(2));
+
+        HPX_TEST_EQ(writer.save(str, values).get(), std::uint64_t(3));
+        HPX_TEST_EQ(writer.get_bytes_written(), std::uint64_t(0));
+    }
+
+    // restore all epochs
+    checkpoint_file_reader reader(base_name, rank);
+    HPX_TEST_EQ(reader.get_latest_epoch(), std::uint64_t(3));
+
+    for (std::uint64_t epoch = 1; epoch <= 3; ++epoch)
+    {
+        std::string str2;
+        std::vector<double> values2;
+        reader.restore(epoch, str2, values2).get();
+
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST_EQ(values2.size(), values.size());
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            double expected = double(i);
+            if (epoch != 1 && i == values.size() / 2)
+                expected = -1.0;
+            HPX_TEST_EQ(values2[i], expected);
+        }
+    }
+
+    remove_files(rank, 3);
+
+    return hpx::util::report_errors();
+}
+#endif
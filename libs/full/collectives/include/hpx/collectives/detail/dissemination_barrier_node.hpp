@@ -0,0 +1,118 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions/base_action.hpp>
+#include <hpx/actions/transfer_action.hpp>
+#include <hpx/actions/transfer_continuation_action.hpp>
+#include <hpx/actions_base/component_action.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime/components/server/component_base.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    // One participant of a dissemination barrier. In round k of each
+    // generation participant r signals participant (r + 2^k) mod num and
+    // waits for the signal of participant (r - 2^k) mod num. After
+    // ceil(log2(num)) rounds every participant transitively knows that all
+    // participants have entered the barrier.
+    class HPX_EXPORT dissemination_barrier_node
+      : public hpx::components::component_base<dissemination_barrier_node>
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+
+    public:
+        dissemination_barrier_node()
+          : num_(0)
+          , rank_(0)
+          , generation_(0)
+        {
+            HPX_ASSERT(false);    // shouldn't ever be called
+        }
+
+        dissemination_barrier_node(
+            std::string const& base_name, std::size_t num, std::size_t rank);
+
+        // resolve the ids of the participants this one signals, this is the
+        // only time the names of the participants are looked up
+        void connect();
+
+        // enter the barrier, the returned future becomes ready once all
+        // participants have entered the barrier
+        hpx::future<void> wait();
+
+        // called by the participant signalling this one in the given round
+        void signal(std::size_t round);
+
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(dissemination_barrier_node, signal);
+
+        std::size_t get_num_rounds() const
+        {
+            return rounds_.size();
+        }
+
+        std::string const& get_base_name() const
+        {
+            return base_name_;
+        }
+
+        std::size_t get_rank() const
+        {
+            return rank_;
+        }
+
+    private:
+        hpx::future<void> wait_round(std::size_t round, std::uint64_t count);
+
+        struct round_data
+        {
+            round_data()
+              : arrived_(0)
+              , awaited_(0)
+              , waiting_(false)
+            {
+            }
+
+            // the number of signals received during this round (over all
+            // generations)
+            std::uint64_t arrived_;
+
+            // the number of signals the waiting participant needs
+            std::uint64_t awaited_;
+            bool waiting_;
+            hpx::lcos::local::promise<void> promise_;
+        };
+
+        mutex_type mtx_;
+        std::string base_name_;
+        std::size_t const num_;
+        std::size_t const rank_;
+        std::uint64_t generation_;
+
+        std::vector<round_data> rounds_;
+        std::vector<hpx::id_type> partners_;
+    };
+}}}    // namespace hpx::lcos::detail
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::lcos::detail::dissemination_barrier_node::signal_action,
+    dissemination_barrier_node_signal_action);
+
+#include <hpx/config/warnings_suffix.hpp>
+#endif
@@ -0,0 +1,117 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/collectives/dissemination_barrier.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace lcos {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        class dissemination_barrier_node;
+    }
+    /// \endcond
+
+    /// The dissemination_barrier performs a barrier over a number of
+    /// participating threads which don't have to be on the same locality,
+    /// like \a hpx::lcos::barrier. Each participant exchanges
+    /// ceil(log2(num)) direct messages per barrier (one per round) with other
+    /// participants instead of funnelling all arrivals through a root. The
+    /// names of the other participants are resolved once when the barrier is
+    /// created, entering the barrier involves no further name lookups.
+    ///
+    /// This makes the barrier scale to large numbers of localities, but
+    /// creating it requires all participants to create their barrier
+    /// instance, as each instance resolves the names of its partners.
+    class HPX_EXPORT dissemination_barrier
+    {
+    public:
+        /// Creates a barrier, rank is locality id, size is number of localities
+        ///
+        /// \param base_name The name of the barrier
+        ///
+        /// A barrier \a base_name is created. It expects that
+        /// hpx::get_num_localities() participate and the local rank is
+        /// hpx::get_locality_id().
+        explicit dissemination_barrier(std::string const& base_name);
+
+        /// Creates a barrier with a given size, rank is locality id
+        ///
+        /// \param base_name The name of the barrier
+        /// \param num The number of participating threads
+        ///
+        /// A barrier \a base_name is created. It expects that
+        /// \a num participate and the local rank is hpx::get_locality_id().
+        dissemination_barrier(std::string const& base_name, std::size_t num);
+
+        /// Creates a barrier with a given size and rank
+        ///
+        /// \param base_name The name of the barrier
+        /// \param num The number of participating threads
+        /// \param rank The rank of the calling site for this invocation
+        ///
+        /// A barrier \a base_name is created. It expects that
+        /// \a num participate and the local rank is \a rank.
+        dissemination_barrier(
+            std::string const& base_name, std::size_t num, std::size_t rank);
+
+        /// \cond NOINTERNAL
+        dissemination_barrier(dissemination_barrier&& other);
+        dissemination_barrier& operator=(dissemination_barrier&& other);
+
+        ~dissemination_barrier();
+        /// \endcond
+
+        /// Wait until each participant entered the barrier. Must be called by
+        /// all participants
+        ///
+        /// \returns This function returns once all participants have entered
+        /// the barrier (have called \a wait).
+        void wait();
+
+        /// Wait until each participant entered the barrier. Must be called by
+        /// all participants
+        ///
+        /// \returns a future that becomes ready once all participants have
+        /// entered the barrier (have called \a wait).
+        hpx::future<void> wait(hpx::launch::async_policy);
+
+        /// Returns the number of message rounds needed by each barrier
+        std::size_t get_num_rounds() const;
+
+        /// \cond NOINTERNAL
+        // Unregisters this participant, waits for all participants to do
+        // the same
+        void release();
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        void create(std::string const& base_name, std::size_t num,
+            std::size_t rank);
+
+        hpx::id_type id_;
+        std::shared_ptr<detail::dissemination_barrier_node> node_;
+        /// \endcond
+    };
+}}    // namespace hpx::lcos
+
+#include <hpx/config/warnings_suffix.hpp>
+#endif
@@ -11,8 +11,10 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/dissemination_barrier.hpp>
 
 namespace hpx { namespace distributed {
     using hpx::lcos::barrier;
+    using hpx::lcos::dissemination_barrier;
 }}    // namespace hpx::distributed
 #endif
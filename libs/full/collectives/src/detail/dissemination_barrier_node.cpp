@@ -0,0 +1,123 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/collectives/detail/dissemination_barrier_node.hpp>
+#include <hpx/modules/async_distributed.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/runtime/basename_registration.hpp>
+#include <hpx/runtime/components/component_factory.hpp>
+#include <hpx/runtime/components/server/component.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using dissemination_barrier_component =
+    hpx::components::component<hpx::lcos::detail::dissemination_barrier_node>;
+
+HPX_REGISTER_COMPONENT(dissemination_barrier_component);
+
+HPX_REGISTER_ACTION(
+    hpx::lcos::detail::dissemination_barrier_node::signal_action,
+    dissemination_barrier_node_signal_action);
+
+namespace hpx { namespace lcos { namespace detail {
+    dissemination_barrier_node::dissemination_barrier_node(
+        std::string const& base_name, std::size_t num, std::size_t rank)
+      : base_name_(base_name)
+      , num_(num)
+      , rank_(rank)
+      , generation_(0)
+    {
+        HPX_ASSERT(rank_ < num_);
+
+        std::size_t num_rounds = 0;
+        for (std::size_t distance = 1; distance < num_; distance *= 2)
+            ++num_rounds;
+
+        rounds_.resize(num_rounds);
+    }
+
+    void dissemination_barrier_node::connect()
+    {
+        std::vector<std::size_t> ids;
+        ids.reserve(rounds_.size());
+
+        std::size_t distance = 1;
+        for (std::size_t i = 0; i != rounds_.size(); ++i, distance *= 2)
+        {
+            ids.push_back((rank_ + distance) % num_);
+        }
+
+        partners_ = hpx::util::unwrap(hpx::find_from_basename(base_name_, ids));
+    }
+
+    hpx::future<void> dissemination_barrier_node::wait()
+    {
+        // round k of generation g needs the g-th signal sent in round k
+        return wait_round(0, ++generation_);
+    }
+
+    hpx::future<void> dissemination_barrier_node::wait_round(
+        std::size_t round, std::uint64_t count)
+    {
+        for (/**/; round != rounds_.size(); ++round)
+        {
+            hpx::apply<signal_action>(partners_[round], round);
+
+            std::unique_lock<mutex_type> l(mtx_);
+
+            round_data& r = rounds_[round];
+            if (r.arrived_ < count)
+            {
+                // suspend this participant until the signal arrives, the
+                // remaining rounds are continued by the signalling thread
+                HPX_ASSERT(!r.waiting_);
+                r.awaited_ = count;
+                r.waiting_ = true;
+                r.promise_ = hpx::lcos::local::promise<void>();
+
+                hpx::future<void> f = r.promise_.get_future();
+                l.unlock();
+
+                return f.then(hpx::launch::sync,
+                    [this, round, count](hpx::future<void>&& signalled) {
+                        signalled.get();
+                        return wait_round(round + 1, count);
+                    });
+            }
+        }
+        return hpx::make_ready_future();
+    }
+
+    void dissemination_barrier_node::signal(std::size_t round)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        HPX_ASSERT(round < rounds_.size());
+        round_data& r = rounds_[round];
+
+        if (++r.arrived_ >= r.awaited_ && r.waiting_)
+        {
+            r.waiting_ = false;
+            hpx::lcos::local::promise<void> p = std::move(r.promise_);
+
+            l.unlock();
+            p.set_value();
+        }
+    }
+}}}    // namespace hpx::lcos::detail
+#endif
@@ -0,0 +1,162 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/detail/dissemination_barrier_node.hpp>
+#include <hpx/collectives/dissemination_barrier.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/runtime/basename_registration.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/components/server/component.hpp>
+#include <hpx/runtime/components/server/runtime_support.hpp>
+#include <hpx/runtime/find_here.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime_distributed/get_num_localities.hpp>
+#include <hpx/runtime_local/run_as_hpx_thread.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
+#include <hpx/state.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx {
+    bool is_stopped_or_shutting_down();
+}
+
+namespace hpx { namespace lcos {
+    dissemination_barrier::dissemination_barrier(std::string const& base_name)
+    {
+        create(base_name,
+            static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync)),
+            static_cast<std::size_t>(hpx::get_locality_id()));
+    }
+
+    dissemination_barrier::dissemination_barrier(
+        std::string const& base_name, std::size_t num)
+    {
+        create(
+            base_name, num, static_cast<std::size_t>(hpx::get_locality_id()));
+    }
+
+    dissemination_barrier::dissemination_barrier(
+        std::string const& base_name, std::size_t num, std::size_t rank)
+    {
+        create(base_name, num, rank);
+    }
+
+    void dissemination_barrier::create(
+        std::string const& base_name, std::size_t num, std::size_t rank)
+    {
+        if (rank >= num)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "dissemination_barrier::dissemination_barrier",
+                "the rank of a participant must be smaller than the number "
+                "of participants");
+        }
+
+        id_ = hpx::new_<detail::dissemination_barrier_node>(
+            hpx::find_here(), base_name, num, rank)
+                  .get();
+        node_ = hpx::get_ptr<detail::dissemination_barrier_node>(
+            hpx::launch::sync, id_);
+
+        if (!hpx::register_with_basename(base_name, id_, rank).get())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "dissemination_barrier::dissemination_barrier",
+                "the given base name for the barrier was already "
+                "registered: " +
+                    base_name);
+        }
+
+        node_->connect();
+    }
+
+    dissemination_barrier::dissemination_barrier(
+        dissemination_barrier&& other)
+      : id_(std::move(other.id_))
+      , node_(std::move(other.node_))
+    {
+        other.id_ = hpx::invalid_id;
+        other.node_.reset();
+    }
+
+    dissemination_barrier& dissemination_barrier::operator=(
+        dissemination_barrier&& other)
+    {
+        release();
+        id_ = std::move(other.id_);
+        node_ = std::move(other.node_);
+        other.id_ = hpx::invalid_id;
+        other.node_.reset();
+
+        return *this;
+    }
+
+    dissemination_barrier::~dissemination_barrier()
+    {
+        release();
+    }
+
+    void dissemination_barrier::wait()
+    {
+        node_->wait().get();
+    }
+
+    hpx::future<void> dissemination_barrier::wait(hpx::launch::async_policy)
+    {
+        // keep the node alive until the future has become ready
+        std::shared_ptr<detail::dissemination_barrier_node> node = node_;
+        return node_->wait().then(hpx::launch::sync,
+            [node = std::move(node)](hpx::future<void>&& f) { f.get(); });
+    }
+
+    std::size_t dissemination_barrier::get_num_rounds() const
+    {
+        HPX_ASSERT(node_);
+        return node_->get_num_rounds();
+    }
+
+    void dissemination_barrier::release()
+    {
+        if (node_)
+        {
+            if (hpx::get_runtime_ptr() != nullptr &&
+                hpx::threads::threadmanager_is(state_running) &&
+                !hpx::is_stopped_or_shutting_down())
+            {
+                // make sure this runs as an HPX thread
+                if (hpx::threads::get_self_ptr() == nullptr)
+                {
+                    hpx::threads::run_as_hpx_thread(
+                        &dissemination_barrier::release, this);
+                    return;
+                }
+
+                // we need to wait on everyone to have its name unregistered
+                // before the name can be reused
+                hpx::when_all(hpx::unregister_with_basename(
+                                  node_->get_base_name(), node_->get_rank()),
+                    wait(hpx::launch::async))
+                    .get();
+            }
+            node_.reset();
+            id_ = hpx::invalid_id;
+        }
+    }
+}}    // namespace hpx::lcos
+#endif
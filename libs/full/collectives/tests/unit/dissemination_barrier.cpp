@@ -0,0 +1,116 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void barrier_test(std::string const& name, std::size_t num, std::size_t rank,
+    std::size_t iterations, std::vector<std::atomic<std::size_t>>& counts)
+{
+    hpx::lcos::dissemination_barrier b(name, num, rank);
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        ++counts[i];
+
+        // wait for all threads to enter the barrier
+        b.wait();
+
+        // no thread leaves the barrier before all threads have entered it
+        HPX_TEST_EQ(counts[i].load(), num);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void local_tests(hpx::program_options::variables_map& vm)
+{
+    std::size_t const pxthreads = vm["pxthreads"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    // vary the number of participants to cover incomplete last rounds
+    for (std::size_t num = 1; num <= pxthreads + 1; num = 2 * num + 1)
+    {
+        std::string const name =
+            hpx::util::format("/test/dissemination_barrier/local_{}/{}",
+                hpx::get_locality_id(), num);
+
+        std::vector<std::atomic<std::size_t>> counts(iterations);
+        for (auto& count : counts)
+            count = 0;
+
+        std::vector<hpx::future<void>> participants;
+        participants.reserve(num);
+        for (std::size_t rank = 0; rank != num; ++rank)
+        {
+            participants.push_back(hpx::async(&barrier_test, std::cref(name),
+                num, rank, iterations, std::ref(counts)));
+        }
+        hpx::wait_all(participants);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void remote_test(hpx::program_options::variables_map& vm)
+{
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    hpx::lcos::dissemination_barrier b("/test/dissemination_barrier/remote");
+    for (std::size_t i = 0; i != iterations; ++i)
+        b.wait();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+        b.wait(hpx::launch::async).get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    local_tests(vm);
+    remote_test(vm);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    // Configure application-specific options
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("pxthreads,T", value<std::size_t>()->default_value(64),
+            "the number of PX threads to invoke")
+        ("iterations", value<std::size_t>()->default_value(64),
+            "the number of times to repeat the test")
+        ;
+    // clang-format on
+
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
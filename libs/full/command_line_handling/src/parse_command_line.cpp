@@ -527,13 +527,16 @@ namespace hpx { namespace util {
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
-                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                  "'static-priority' (default: 'local-priority'; "
+                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
+                  "'static-priority', 'local-deadline', and 'fair-share' "
+                  "(default: "
+                  "'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
                   "priority queue (default: number of OS threads), valid for "
                   "--hpx:queuing=local-priority,--hpx:queuing=static-priority, "
+                  "--hpx:queuing=local-deadline, --hpx:queuing=fair-share, "
                   " and --hpx:queuing=abp-priority only)")
                 ("hpx:numa-sensitive", value<std::size_t>()->implicit_value(0),
                   "makes the local-priority scheduler NUMA sensitive ("
@@ -628,7 +631,8 @@ namespace hpx { namespace util {
                   "   'full' (prints all available counter infos)")
                 ("hpx:print-counter-format", value<std::string>(),
                   "print the performance counter(s) specified with --hpx:print-counter "
-                  "in a given format (default: normal)")
+                  "in a given format, possible values: 'normal' (default), "
+                  "'csv', 'csv-short', 'binary'")
                 ("hpx:csv-header",
                   "print the performance counter(s) specified with --hpx:print-counter "
                   "with header when format specified with --hpx:print-counter-format"
@@ -12,6 +12,8 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/compute/detail/iterator.hpp>
 #include <hpx/compute/detail/new.hpp>
 #include <hpx/compute/host/block_executor.hpp>
 #include <hpx/compute/host/target.hpp>
@@ -279,3 +281,48 @@ namespace hpx { namespace compute { namespace host {
         }
     };
 }}}    // namespace hpx::compute::host
+
+namespace hpx { namespace traits {
+    // Segmented algorithms run on the elements of a compute::vector using a
+    // block_allocator on the targets the memory has been bound to. Execution
+    // policies carrying a user supplied executor are left unchanged.
+    template <typename U, typename T, typename Executor>
+    struct segmented_local_policy<compute::detail::iterator<U,
+        compute::host::block_allocator<T, Executor>>>
+    {
+        using iterator_type = compute::detail::iterator<U,
+            compute::host::block_allocator<T, Executor>>;
+
+        template <typename ExPolicy>
+        struct uses_default_executor
+          : std::integral_constant<bool,
+                std::is_same<ExPolicy,
+                    hpx::execution::parallel_policy>::value ||
+                    std::is_same<ExPolicy,
+                        hpx::execution::parallel_task_policy>::value>
+        {
+        };
+
+        template <typename ExPolicy>
+        static ExPolicy&& call(
+            ExPolicy&& policy, iterator_type const&, std::false_type)
+        {
+            return std::forward<ExPolicy>(policy);
+        }
+
+        template <typename ExPolicy>
+        static auto call(
+            ExPolicy&& policy, iterator_type const& it, std::true_type)
+        {
+            return policy.on(
+                compute::host::block_executor<Executor>(it.target()));
+        }
+
+        template <typename ExPolicy>
+        static decltype(auto) call(ExPolicy&& policy, iterator_type const& it)
+        {
+            return call(std::forward<ExPolicy>(policy), it,
+                uses_default_executor<typename std::decay<ExPolicy>::type>());
+        }
+    };
+}}    // namespace hpx::traits
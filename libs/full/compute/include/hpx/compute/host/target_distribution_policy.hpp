@@ -21,11 +21,14 @@
 #include <hpx/traits/is_distribution_policy.hpp>
 
 #include <hpx/compute/detail/target_distribution_policy.hpp>
+#include <hpx/compute/host/numa_domains.hpp>
 #include <hpx/compute/host/target.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <map>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -226,6 +229,222 @@ namespace hpx { namespace compute { namespace host {
     /// localities. It will represent all NUMA domains of the given locality
     /// and will place all items to create here.
     static target_distribution_policy const target_layout;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A numa_distribution_policy places each item to create onto exactly one
+    /// of its targets, consecutive items are placed onto the same target. By
+    /// default the targets are the NUMA domains of the current locality. Each
+    /// item is created with a list holding its single target as the last
+    /// constructor argument. Together with a \a block_allocator this places
+    /// every partition of a partitioned_vector onto one NUMA domain.
+    struct numa_distribution_policy
+      : compute::detail::target_distribution_policy<host::target>
+    {
+        typedef compute::detail::target_distribution_policy<host::target>
+            base_type;
+
+        /// Default-construct a new instance of a \a numa_distribution_policy.
+        /// This policy will represent all NUMA domains of the current
+        /// locality and will create one item per NUMA domain.
+        ///
+        numa_distribution_policy() {}
+
+        /// Create a new \a numa_distribution_policy representing the NUMA
+        /// domains of the current locality which creates the given number of
+        /// items
+        ///
+        /// \param num_partitions [in] The number of items to create
+        ///
+        numa_distribution_policy operator()(std::size_t num_partitions) const
+        {
+            return numa_distribution_policy(
+                std::vector<target_type>(), num_partitions);
+        }
+
+        /// Create a new \a numa_distribution_policy representing the given
+        /// set of targets
+        ///
+        /// \param targets [in] The targets the new instances should represent
+        ///
+        numa_distribution_policy operator()(
+            std::vector<target_type> const& targets,
+            std::size_t num_partitions = std::size_t(-1)) const
+        {
+            return numa_distribution_policy(targets, num_partitions);
+        }
+
+        /// Create a new \a numa_distribution_policy representing the given
+        /// set of targets
+        ///
+        /// \param targets [in] The targets the new instances should represent
+        ///
+        numa_distribution_policy operator()(
+            std::vector<target_type>&& targets,
+            std::size_t num_partitions = std::size_t(-1)) const
+        {
+            return numa_distribution_policy(
+                std::move(targets), num_partitions);
+        }
+
+        std::size_t get_num_partitions() const
+        {
+            init_targets();
+            return base_type::get_num_partitions();
+        }
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        /// Create one object on one of the targets associated by this policy
+        /// instance
+        ///
+        /// \param ts  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... ts) const
+        {
+            init_targets();
+
+            target_type t = this->get_next_target();
+            hpx::id_type target_locality = t.get_locality();
+            return components::create_async<Component>(target_locality,
+                std::forward<Ts>(ts)...,
+                std::vector<target_type>(1, std::move(t)));
+        }
+#endif
+
+        /// \cond NOINTERNAL
+        typedef std::pair<hpx::id_type, std::vector<hpx::id_type>>
+            bulk_locality_result;
+        /// \endcond
+
+        /// Create multiple objects on the targets associated by this policy
+        /// instance
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count, Ts&&... ts) const
+        {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+            HPX_ASSERT(false);
+            return hpx::future<std::vector<bulk_locality_result>>();
+#else
+            std::vector<target_type> targets;
+            {
+                init_targets();
+                std::lock_guard<hpx::lcos::local::spinlock> l(this->mtx_);
+                targets = this->targets_;
+            }
+
+            // create the objects separately as each of them is bound to its
+            // own target, collect the objects created on the same locality
+            std::map<hpx::id_type, std::vector<hpx::future<hpx::id_type>>> m;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                target_type const& t = targets[(i * targets.size()) / count];
+                hpx::id_type target_locality = t.get_locality();
+                m[target_locality].push_back(
+                    components::create_async<Component>(target_locality, ts...,
+                        std::vector<target_type>(1, t)));
+            }
+
+            std::vector<hpx::id_type> localities;
+            localities.reserve(m.size());
+
+            std::vector<hpx::future<std::vector<hpx::id_type>>> objs;
+            objs.reserve(m.size());
+
+            for (auto&& p : m)
+            {
+                localities.push_back(p.first);
+                objs.push_back(hpx::dataflow(hpx::launch::sync,
+                    [](std::vector<hpx::future<hpx::id_type>>&& ids)
+                        -> std::vector<hpx::id_type> {
+                        std::vector<hpx::id_type> result;
+                        result.reserve(ids.size());
+                        for (hpx::future<hpx::id_type>& f : ids)
+                        {
+                            result.push_back(f.get());
+                        }
+                        return result;
+                    },
+                    std::move(p.second)));
+            }
+
+            return hpx::dataflow(
+                [=](std::vector<hpx::future<std::vector<hpx::id_type>>>&&
+                        v) mutable -> std::vector<bulk_locality_result> {
+                    HPX_ASSERT(localities.size() == v.size());
+
+                    std::vector<bulk_locality_result> result;
+                    result.reserve(v.size());
+
+                    for (std::size_t i = 0; i != v.size(); ++i)
+                    {
+                        result.emplace_back(
+                            std::move(localities[i]), v[i].get());
+                    }
+
+                    return result;
+                },
+                std::move(objs));
+#endif
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        numa_distribution_policy(
+            std::vector<target_type> const& targets, std::size_t num_partitions)
+          : base_type(targets, num_partitions)
+        {
+        }
+
+        numa_distribution_policy(
+            std::vector<target_type>&& targets, std::size_t num_partitions)
+          : base_type(std::move(targets), num_partitions)
+        {
+        }
+
+        // default to the NUMA domains instead of the processing units of the
+        // current locality
+        void init_targets() const
+        {
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(this->mtx_);
+                if (!this->targets_.empty())
+                    return;
+            }
+
+            std::vector<target_type> domains = host::numa_domains();
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(this->mtx_);
+            if (this->targets_.empty())
+                this->targets_ = std::move(domains);
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            ar& serialization::base_object<base_type>(*this);
+        }
+        /// \endcond
+    };
+
+    /// A predefined instance of the \a numa_distribution_policy. It will
+    /// represent all NUMA domains of the current locality and will place one
+    /// item onto each of them.
+    static numa_distribution_policy const numa_layout;
 }}}    // namespace hpx::compute::host
 
 /// \cond NOINTERNAL
@@ -245,6 +464,22 @@ namespace hpx { namespace traits {
             return policy.get_num_partitions();
         }
     };
+
+    template <>
+    struct is_distribution_policy<compute::host::numa_distribution_policy>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct num_container_partitions<compute::host::numa_distribution_policy>
+    {
+        static std::size_t call(
+            compute::host::numa_distribution_policy const& policy)
+        {
+            return policy.get_num_partitions();
+        }
+    };
 }}    // namespace hpx::traits
 /// \endcond
 
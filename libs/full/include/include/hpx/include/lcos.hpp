@@ -15,6 +15,7 @@
 
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) && !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/collectives/barrier.hpp>
+#include <hpx/collectives/dissemination_barrier.hpp>
 #include <hpx/collectives/gather.hpp>
 #include <hpx/collectives/latch.hpp>
 #include <hpx/collectives/reduce.hpp>
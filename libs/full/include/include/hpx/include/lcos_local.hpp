@@ -17,6 +17,7 @@
 #include <hpx/lcos_local/and_gate.hpp>
 #include <hpx/lcos_local/packaged_task.hpp>
 #include <hpx/lcos_local/receive_buffer.hpp>
+#include <hpx/lcos_local/task_graph.hpp>
 #include <hpx/lcos_local/trigger.hpp>
 #include <hpx/modules/execution.hpp>
 #include <hpx/modules/futures.hpp>
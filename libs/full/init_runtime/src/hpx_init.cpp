@@ -534,6 +534,14 @@ namespace hpx {
                     destination =
                         vm["hpx:print-counter-destination"].as<std::string>();
 
+                if (counter_format == "binary" && destination == "cout")
+                {
+                    throw detail::command_line_error(
+                        "Invalid command line option "
+                        "--hpx:print-counter-format=binary, requires a file "
+                        "given by --hpx:print-counter-destination");
+                }
+
                 bool counter_types = false;
                 if (vm.count("hpx:print-counter-types"))
                     counter_types = true;
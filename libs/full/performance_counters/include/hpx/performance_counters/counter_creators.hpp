@@ -110,6 +110,25 @@ namespace hpx { namespace performance_counters {
         hpx::util::function_nonser<std::vector<std::int64_t>(bool)> const&,
         error_code&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Creation function for percentile counters. The passed function is
+    /// invoked with the percentile (0..100) given as the counter parameter
+    /// (defaulting to 50) and is expected to return the value at that
+    /// percentile. This function checks the validity of the supplied counter
+    /// name, it has to follow the scheme:
+    ///
+    ///   /<objectname>(locality#<locality_id>/total)/<instancename>@<percentile>
+    ///
+    HPX_EXPORT naming::gid_type locality_percentile_counter_creator(
+        counter_info const&,
+        hpx::util::function_nonser<std::int64_t(double, bool)> const&,
+        error_code&);
+
+    /// Return the percentile (0..100) given as the parameter of the counter
+    /// described by the given path elements, defaulting to 50.
+    HPX_EXPORT double get_counter_percentile(
+        counter_path_elements const&, error_code&);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Creation function for raw counters. The passed function is encapsulating
     /// the actual value to monitor. This function checks the validity of the
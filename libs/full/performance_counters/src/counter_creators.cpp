@@ -18,8 +18,11 @@
 #include <hpx/runtime/agas/server/locality_namespace.hpp>
 #include <hpx/runtime/agas/server/symbol_namespace.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <string>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -496,6 +499,77 @@ namespace hpx { namespace performance_counters {
         return naming::invalid_gid;
     }
 
+    double get_counter_percentile(
+        counter_path_elements const& paths, error_code& ec)
+    {
+        if (paths.parameters_.empty())
+            return 50.0;
+
+        // the whole parameter has to be a number in the range [0, 100]
+        double percentile = -1.0;
+        try
+        {
+            std::size_t pos = 0;
+            percentile = std::stod(paths.parameters_, &pos);
+            if (pos != paths.parameters_.size())
+                percentile = -1.0;
+        }
+        catch (std::exception const&)
+        {
+            percentile = -1.0;
+        }
+
+        if (!(percentile >= 0.0 && percentile <= 100.0))
+        {
+            HPX_THROWS_IF(ec, bad_parameter, "get_counter_percentile",
+                "invalid percentile specified (must be in range [0, 100]): " +
+                    paths.parameters_);
+            return 0.0;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return percentile;
+    }
+
+    naming::gid_type locality_percentile_counter_creator(
+        counter_info const& info,
+        hpx::util::function_nonser<std::int64_t(double, bool)> const& f,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "locality_percentile_counter_creator",
+                "invalid counter instance parent name: " +
+                    paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            double percentile = get_counter_percentile(paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            hpx::util::function_nonser<std::int64_t(bool)> get_value =
+                [f, percentile](bool reset) { return f(percentile, reset); };
+            return detail::create_raw_counter(
+                info, std::move(get_value), ec);    // overall counter
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "locality_percentile_counter_creator",
+            "invalid counter instance name: " + paths.instancename_);
+        return naming::invalid_gid;
+    }
+
     namespace detail {
 
         naming::gid_type retrieve_agas_counter(std::string const& name,
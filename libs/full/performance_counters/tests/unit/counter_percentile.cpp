@@ -0,0 +1,140 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+double get_percentile(std::string const& name, hpx::error_code& ec)
+{
+    hpx::performance_counters::counter_path_elements paths;
+    hpx::performance_counters::get_counter_path_elements(name, paths);
+    return hpx::performance_counters::get_counter_percentile(paths, ec);
+}
+
+void test_get_counter_percentile()
+{
+    // the percentile defaults to 50
+    HPX_TEST_EQ(get_percentile("/test{locality#0/total}/percentile", hpx::throws),
+        50.0);
+
+    HPX_TEST_EQ(
+        get_percentile("/test{locality#0/total}/percentile@0", hpx::throws),
+        0.0);
+    HPX_TEST_EQ(
+        get_percentile("/test{locality#0/total}/percentile@99.9", hpx::throws),
+        99.9);
+    HPX_TEST_EQ(
+        get_percentile("/test{locality#0/total}/percentile@100", hpx::throws),
+        100.0);
+
+    // values outside of [0, 100] and non-numeric values are rejected
+    std::vector<std::string> const invalid = {
+        "/test{locality#0/total}/percentile@-1",
+        "/test{locality#0/total}/percentile@100.1",
+        "/test{locality#0/total}/percentile@p99",
+        "/test{locality#0/total}/percentile@99abc"};
+
+    for (std::string const& name : invalid)
+    {
+        hpx::error_code ec(hpx::lightweight);
+        get_percentile(name, ec);
+        HPX_TEST(ec);
+        HPX_TEST_EQ(ec.value(), hpx::bad_parameter);
+
+        bool caught_exception = false;
+        try
+        {
+            get_percentile(name, hpx::throws);
+            HPX_TEST(false);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_value(double percentile, bool)
+{
+    return static_cast<std::int64_t>(percentile * 10);
+}
+
+void register_counter_type()
+{
+    using hpx::util::placeholders::_1;
+    using hpx::util::placeholders::_2;
+
+    hpx::util::function_nonser<std::int64_t(double, bool)> f(&get_value);
+
+    hpx::performance_counters::generic_counter_type_data const
+        counter_types[] = {{"/test/percentile",
+            hpx::performance_counters::counter_raw,
+            "returns ten times the percentile given as the counter parameter",
+            HPX_PERFORMANCE_COUNTER_V1,
+            hpx::util::bind(
+                &hpx::performance_counters::locality_percentile_counter_creator,
+                _1, f, _2),
+            &hpx::performance_counters::locality_counter_discoverer, ""}};
+
+    hpx::performance_counters::install_counter_types(
+        counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+}
+
+void test_percentile_counter()
+{
+    using hpx::performance_counters::performance_counter;
+
+    performance_counter p50("/test{locality#0/total}/percentile");
+    HPX_TEST_EQ(p50.get_value<std::int64_t>(hpx::launch::sync), 500);
+
+    performance_counter p99("/test{locality#0/total}/percentile@99");
+    HPX_TEST_EQ(p99.get_value<std::int64_t>(hpx::launch::sync), 990);
+
+    bool caught_exception = false;
+    try
+    {
+        performance_counter invalid("/test{locality#0/total}/percentile@101");
+        invalid.get_value<std::int64_t>(hpx::launch::sync);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_get_counter_percentile();
+    test_percentile_counter();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::register_startup_function(&register_counter_type);
+
+    // Initialize and run HPX.
+    return hpx::init(argc, argv);
+}
+#endif
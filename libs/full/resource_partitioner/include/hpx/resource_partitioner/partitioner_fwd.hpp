@@ -71,5 +71,7 @@ namespace hpx { namespace resource {
         abp_priority_fifo = 5,
         abp_priority_lifo = 6,
         shared_priority = 7,
+        local_deadline = 8,
+        fair_share = 9,
     };
 }}    // namespace hpx::resource
@@ -148,6 +148,12 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_deadline:
+            sched = "local_deadline";
+            break;
+        case resource::fair_share:
+            sched = "fair_share";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -466,6 +472,14 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("local-deadline").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_deadline;
+        }
+        else if (0 == std::string("fair-share").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::fair_share;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -88,6 +88,12 @@ namespace hpx { namespace util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the number of incref requests to stage before they are sent to
+        // AGAS and the maximal time (in microseconds) to wait before staged
+        // increfs are flushed
+        std::size_t get_agas_max_pending_incref_requests() const;
+        std::int64_t get_agas_incref_flush_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
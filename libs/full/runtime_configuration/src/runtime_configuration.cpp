@@ -174,6 +174,7 @@ namespace hpx { namespace util {
             "pu_step = 1",
             "pu_offset = 0",
             "numa_sensitive = 0",
+            "steal_by_distance = ${HPX_STEAL_BY_DISTANCE:0}",
             "max_background_threads = "
             "${HPX_MAX_BACKGROUND_THREADS:$[hpx.os_threads]}",
 
@@ -199,6 +200,14 @@ namespace hpx { namespace util {
             "trace_depth = ${HPX_TRACE_DEPTH:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_HAVE_THREAD_BACKTRACE_DEPTH)) "}",
 
+            // per worker task trace, see hpx::threads::task_trace
+            "[hpx.task_trace]",
+            "enabled = ${HPX_TASK_TRACE:0}",
+            "capacity = ${HPX_TASK_TRACE_CAPACITY:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_INITIAL_TASK_TRACE_CAPACITY)) "}",
+            "filename = ${HPX_TASK_TRACE_FILENAME:hpx_task_trace.json}",
+            "dump_at_exit = ${HPX_TASK_TRACE_DUMP_AT_EXIT:1}",
+
             // arity for collective operations implemented in a tree fashion
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
@@ -313,6 +322,11 @@ namespace hpx { namespace util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_pending_incref_requests = "
+            "${HPX_AGAS_MAX_PENDING_INCREF_REQUESTS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(
+                    HPX_INITIAL_AGAS_MAX_PENDING_INCREF_REQUESTS)) "}",
+            "incref_flush_delay = ${HPX_AGAS_INCREF_FLUSH_DELAY:0}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -392,6 +406,9 @@ namespace hpx { namespace util {
                 "(T%locality%/%hpxthread%.%hpxphase%/%hpxcomponent%) "
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
                 HPX_TIMEFORMAT ") [%idx%]|\\n}",
+            "async = ${HPX_LOGASYNC:0}",
+            "async_queue_size = ${HPX_LOGASYNC_QUEUE_SIZE:4096}",
+            "async_drop_on_overflow = ${HPX_LOGASYNC_DROP_ON_OVERFLOW:1}",
 
             // general console logging
             "[hpx.logging.console]",
@@ -969,6 +986,36 @@ namespace hpx { namespace util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_max_pending_incref_requests()
+        const
+    {
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(*sec,
+                    "max_pending_incref_requests",
+                    HPX_INITIAL_AGAS_MAX_PENDING_INCREF_REQUESTS);
+            }
+        }
+        return HPX_INITIAL_AGAS_MAX_PENDING_INCREF_REQUESTS;
+    }
+
+    std::int64_t runtime_configuration::get_agas_incref_flush_delay() const
+    {
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::int64_t>(
+                    *sec, "incref_flush_delay", 0);
+            }
+        }
+        return 0;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -259,15 +259,24 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                         Args>::type>::local(std::forward<Args>(args))...));
         }
 
-        template <typename ExPolicy, typename... Args>
+        // the first local iterator decides about the execution policy to
+        // use for the segment (see traits::segmented_local_policy)
+        template <typename ExPolicy, typename Arg, typename... Args>
         static HPX_FORCEINLINE R parallel(
-            Algo const& algo, ExPolicy&& policy, Args&&... args)
+            Algo const& algo, ExPolicy&& policy, Arg&& arg, Args&&... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
-            return detail::algorithm_result_helper<R>::call(
-                algo.call(std::forward<ExPolicy>(policy), std::false_type(),
-                    segmented_local_iterator_traits<typename std::decay<
-                        Args>::type>::local(std::forward<Args>(args))...));
+            using hpx::traits::segmented_local_policy;
+
+            auto first = segmented_local_iterator_traits<typename std::decay<
+                Arg>::type>::local(std::forward<Arg>(arg));
+
+            return detail::algorithm_result_helper<R>::call(algo.call(
+                segmented_local_policy<decltype(first)>::call(
+                    std::forward<ExPolicy>(policy), first),
+                std::false_type(), std::move(first),
+                segmented_local_iterator_traits<typename std::decay<
+                    Args>::type>::local(std::forward<Args>(args))...));
         }
     };
 
@@ -285,13 +294,21 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
                     Args>::type>::local(std::forward<Args>(args))...);
         }
 
-        template <typename ExPolicy, typename... Args>
+        template <typename ExPolicy, typename Arg, typename... Args>
         static HPX_FORCEINLINE
             typename parallel::util::detail::algorithm_result<ExPolicy>::type
-            parallel(Algo const& algo, ExPolicy&& policy, Args&&... args)
+            parallel(Algo const& algo, ExPolicy&& policy, Arg&& arg,
+                Args&&... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
-            return algo.call(std::forward<ExPolicy>(policy), std::false_type(),
+            using hpx::traits::segmented_local_policy;
+
+            auto first = segmented_local_iterator_traits<typename std::decay<
+                Arg>::type>::local(std::forward<Arg>(arg));
+
+            return algo.call(segmented_local_policy<decltype(first)>::call(
+                                 std::forward<ExPolicy>(policy), first),
+                std::false_type(), std::move(first),
                 segmented_local_iterator_traits<typename std::decay<
                     Args>::type>::local(std::forward<Args>(args))...);
         }
@@ -310,6 +310,11 @@ namespace hpx { namespace threads {
 
         // performance counters
         std::int64_t get_queue_length(bool reset);
+        std::int64_t get_num_missed_deadlines(bool reset);
+        std::int64_t get_average_deadline_lateness(bool reset);
+        std::int64_t get_tenant_cpu_time(tenant_id tenant, bool reset);
+        std::int64_t get_num_stolen_at_distance(
+            policies::steal_distance distance, bool reset);
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset);
         std::int64_t get_average_task_wait_time(bool reset);
@@ -373,6 +378,8 @@ namespace hpx { namespace threads {
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         std::int64_t get_thread_duration(bool reset);
         std::int64_t get_thread_phase_duration(bool reset);
+        std::int64_t get_thread_phase_duration_percentile(
+            double percentile, bool reset);
         std::int64_t get_thread_overhead(bool reset);
         std::int64_t get_thread_phase_overhead(bool reset);
         std::int64_t get_cumulative_thread_duration(bool reset);
@@ -22,8 +22,10 @@
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/runtime/threads/thread_pool_suspension_helpers.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/task_trace.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -43,6 +45,10 @@
 #include <utility>
 #include <vector>
 
+#if !defined(HPX_WINDOWS)
+#include <signal.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace detail {
 
@@ -82,6 +88,59 @@ namespace hpx { namespace detail {
 }}    // namespace hpx::detail
 
 namespace hpx { namespace threads {
+    namespace detail {
+#if !defined(HPX_WINDOWS)
+        void on_task_trace_signal(int)
+        {
+            // the trace is written by the next idling worker thread
+            task_trace::request_dump();
+        }
+#endif
+
+        void init_task_trace(
+            util::runtime_configuration const& rtcfg, std::size_t num_threads)
+        {
+            if (hpx::util::from_string<int>(
+                    rtcfg.get_entry("hpx.task_trace.enabled", "0"), 0) == 0)
+            {
+                return;
+            }
+
+            task_trace::enable(num_threads,
+                hpx::util::from_string<std::size_t>(
+                    rtcfg.get_entry("hpx.task_trace.capacity",
+                        HPX_INITIAL_TASK_TRACE_CAPACITY)),
+                rtcfg.get_entry(
+                    "hpx.task_trace.filename", "hpx_task_trace.json"));
+
+#if !defined(HPX_WINDOWS)
+            // SIGUSR2 writes the events recorded so far
+            struct sigaction new_action;
+            new_action.sa_handler = on_task_trace_signal;
+            sigemptyset(&new_action.sa_mask);
+            new_action.sa_flags = SA_RESTART;
+
+            sigaction(SIGUSR2, &new_action, nullptr);
+#endif
+        }
+
+        void finalize_task_trace(util::runtime_configuration const& rtcfg)
+        {
+            if (!task_trace::enabled())
+                return;
+
+            task_trace::disable();
+
+            if (hpx::util::from_string<int>(
+                    rtcfg.get_entry("hpx.task_trace.dump_at_exit", "1"), 1) !=
+                0)
+            {
+                task_trace::request_dump();
+                task_trace::handle_dump_request();
+            }
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     threadmanager::threadmanager(
 #ifdef HPX_HAVE_TIMER_POOL
@@ -218,6 +277,10 @@ namespace hpx { namespace threads {
             std::string affinity_desc;
             std::size_t numa_sensitive =
                 hpx::util::get_affinity_description(cfg_, affinity_desc);
+            bool const steal_by_distance =
+                hpx::util::from_string<int>(
+                    cfg_.rtcfg_.get_entry("hpx.steal_by_distance", "0"), 0) !=
+                0;
 
             switch (sched_type)
             {
@@ -300,6 +363,11 @@ namespace hpx { namespace threads {
                 // conditionally set/unset this flag
                 sched->update_scheduler_mode(
                     policies::enable_stealing_numa, !numa_sensitive);
+                if (steal_by_distance)
+                {
+                    sched->add_scheduler_mode(
+                        policies::enable_stealing_topology);
+                }
 
                 // instantiate the pool
                 std::unique_ptr<thread_pool_base> pool(
@@ -337,6 +405,11 @@ namespace hpx { namespace threads {
                 // conditionally set/unset this flag
                 sched->update_scheduler_mode(
                     policies::enable_stealing_numa, !numa_sensitive);
+                if (steal_by_distance)
+                {
+                    sched->add_scheduler_mode(
+                        policies::enable_stealing_topology);
+                }
 
                 // instantiate the pool
                 std::unique_ptr<thread_pool_base> pool(
@@ -556,6 +629,94 @@ namespace hpx { namespace threads {
 #endif
                 break;
             }
+
+            case resource::local_deadline:
+            {
+#if defined(HPX_HAVE_LOCAL_DEADLINE_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_deadline_queue_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_deadline_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->add_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=local-deadline "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=local-deadline'.");
+#endif
+                break;
+            }
+
+            case resource::fair_share:
+            {
+#if defined(HPX_HAVE_FAIR_SHARE_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_fair_share_queue_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_fair_share_queue_scheduler");
+
+                // the quantum (in nanoseconds) granted to a tenant with a
+                // weight of one per scheduling round, the scheduler falls back
+                // to its default if none is given
+                std::int64_t quantum = hpx::util::from_string<std::int64_t>(
+                    cfg_.rtcfg_.get_entry("hpx.fair_share.quantum", "0"), 0);
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init, true, quantum));
+
+                // set the default scheduler flags
+                sched->add_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=fair-share "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=fair-share'.");
+#endif
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -588,6 +749,10 @@ namespace hpx { namespace threads {
             pool_iter->init(num_threads_in_pool, threads_offset);
             threads_offset += num_threads_in_pool;
         }
+
+        // enable the task tracer, if requested
+        detail::init_task_trace(
+            rp.get_command_line_switches().rtcfg_, threads_offset);
     }
 
     void threadmanager::print_pools(std::ostream& os)
@@ -823,6 +988,56 @@ namespace hpx { namespace threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_num_missed_deadlines(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_missed_deadlines(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_deadline_lateness(bool reset)
+    {
+        // average over the pools which have seen missed deadlines
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t const lateness =
+                pool_iter->get_average_deadline_lateness(all_threads, reset);
+            if (lateness != 0)
+            {
+                result += lateness;
+                ++count;
+            }
+        }
+        return count != 0 ? result / count : 0;
+    }
+
+    std::int64_t threadmanager::get_tenant_cpu_time(
+        tenant_id tenant, bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result +=
+                pool_iter->get_tenant_cpu_time(tenant, all_threads, reset);
+        }
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_at_distance(
+        policies::steal_distance distance, bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_num_stolen_at_distance(
+                all_threads, distance, reset);
+        }
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset)
     {
@@ -968,6 +1183,21 @@ namespace hpx { namespace threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_thread_phase_duration_percentile(
+        double percentile, bool reset)
+    {
+        // all pools measure time using the same timestamp source
+        util::log_linear_histogram::counts_type counts;
+        for (auto const& pool_iter : pools_)
+            pool_iter->get_thread_phase_duration_histogram(
+                all_threads, counts, reset);
+
+        return std::int64_t(
+            double(util::log_linear_histogram::get_percentile(
+                counts, percentile)) *
+            default_pool().get_timestamp_scale());
+    }
+
     std::int64_t threadmanager::get_thread_overhead(bool reset)
     {
         std::int64_t result = 0;
@@ -1140,6 +1370,14 @@ namespace hpx { namespace threads {
             pool_iter->stop(lk, blocking);
         }
         deinit_tss();
+
+        // all worker threads have stopped recording at this point
+        if (blocking)
+        {
+            detail::finalize_task_trace(hpx::resource::get_partitioner()
+                                            .get_command_line_switches()
+                                            .rtcfg_);
+        }
     }
 
     void threadmanager::suspend()
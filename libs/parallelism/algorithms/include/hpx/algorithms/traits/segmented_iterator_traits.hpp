@@ -65,4 +65,18 @@ namespace hpx { namespace traits {
       : segmented_local_iterator_traits<Iterator>::is_segmented_local_iterator
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // trait allowing a local segment to adapt the execution policy which is
+    // used to run an algorithm on its elements, e.g. to execute the algorithm
+    // on the cores close to the memory the segment has been placed on
+    template <typename LocalRawIterator, typename Enable = void>
+    struct segmented_local_policy
+    {
+        template <typename ExPolicy>
+        static ExPolicy&& call(ExPolicy&& policy, LocalRawIterator const&)
+        {
+            return std::forward<ExPolicy>(policy);
+        }
+    };
 }}    // namespace hpx::traits
@@ -82,8 +82,9 @@ namespace hpx { namespace parallel { namespace util {
     }    // namespace detail
 
     template <typename ExPolicy, typename Begin, typename End, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr Begin loop(
-        ExPolicy&&, Begin begin, End end, F&& f)
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Begin>::type
+    loop(ExPolicy&&, Begin begin, End end, F&& f)
     {
         return detail::loop<Begin>::call(begin, end, std::forward<F>(f));
     }
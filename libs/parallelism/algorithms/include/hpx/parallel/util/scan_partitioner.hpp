@@ -11,13 +11,17 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/type_support/unwrap_ref.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/async_local/dataflow.hpp>
 #endif
 
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/lookback_scan.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -26,8 +30,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -45,6 +51,65 @@ namespace hpx { namespace parallel { namespace util {
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The single-pass (decoupled look-back) scan is used instead of the
+        // scan partitioner tag given by the algorithm if the lookback_scan
+        // executor parameters were specified.
+        template <bool SequentialF3>
+        struct scan_partitioner_lookback_tag
+        {
+        };
+
+        template <typename ScanPartTag, typename Parameters,
+            typename Enable = void>
+        struct select_scan_partitioner_tag
+        {
+            using type = ScanPartTag;
+        };
+
+        template <typename Parameters>
+        struct select_scan_partitioner_tag<scan_partitioner_normal_tag,
+            Parameters,
+            typename std::enable_if<execution::is_lookback_scan_parameters<
+                Parameters>::value>::type>
+        {
+            using type = scan_partitioner_lookback_tag<false>;
+        };
+
+        template <typename Parameters>
+        struct select_scan_partitioner_tag<scan_partitioner_sequential_f3_tag,
+            Parameters,
+            typename std::enable_if<execution::is_lookback_scan_parameters<
+                Parameters>::value>::type>
+        {
+            using type = scan_partitioner_lookback_tag<true>;
+        };
+
+        // state of a tile of the single-pass scan
+        enum lookback_tile_status
+        {
+            lookback_tile_not_ready = 0,
+            lookback_tile_aggregate = 1,    // local aggregate is available
+            lookback_tile_prefix = 2,       // inclusive prefix is available
+            lookback_tile_f3_done = 3       // step 3 has finished
+        };
+
+        template <typename Parameters>
+        std::size_t get_lookback_tile_size(
+            Parameters const& params, std::size_t cores, std::size_t count)
+        {
+            std::size_t tile_size =
+                hpx::util::unwrap_ref(params).get_tile_size();
+            if (tile_size == 0)
+            {
+                // create a couple of tiles per core, but keep the tiles small
+                // enough to be still in cache for the final step
+                tile_size = (count + 4 * cores - 1) / (4 * cores);
+                tile_size = (std::min)(tile_size, std::size_t(32768));
+            }
+            return (std::max)(tile_size, std::size_t(1));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -281,13 +346,189 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            // Single-pass scan with decoupled look-back: a fixed number of
+            // tasks dynamically pick the tiles from left to right. Each tile
+            // publishes its local aggregate (step 1), combines the published
+            // values of the tiles to its left until it finds an inclusive
+            // prefix (step 2), publishes its own inclusive prefix, and runs
+            // step 3 right away. If SequentialF3 is set, step 3 is run for
+            // one tile after the other.
+            template <bool SequentialF3, typename ExPolicy_, typename FwdIter,
+                typename T, typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_lookback_tag<SequentialF3>,
+                ExPolicy_ policy, FwdIter first, std::size_t count, T&& init,
+                F1&& f1, F2&& f2, F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                std::vector<hpx::future<Result2>> finalitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    HPX_ASSERT(count > 0);
+
+                    std::size_t const cores =
+                        execution::processing_units_count(
+                            policy.parameters(), policy.executor());
+                    std::size_t const tile_size = get_lookback_tile_size(
+                        policy.parameters(), cores, count);
+                    std::size_t const num_tiles =
+                        (count + tile_size - 1) / tile_size;
+
+                    std::vector<FwdIter> tiles;
+                    tiles.reserve(num_tiles);
+                    for (std::size_t i = 0; i != num_tiles; ++i)
+                    {
+                        tiles.push_back(first);
+                        if (i != num_tiles - 1)
+                        {
+                            std::advance(first, tile_size);
+                        }
+                    }
+
+                    // workitems[i + 1] holds the inclusive prefix of tile i
+                    workitems.resize(num_tiles + 1);
+                    workitems[0] = make_ready_future(std::forward<T>(init));
+                    finalitems.resize(num_tiles);
+
+                    std::vector<hpx::shared_future<Result1>> aggregates(
+                        num_tiles);
+                    std::vector<hpx::util::cache_aligned_data<std::atomic<int>>>
+                        status(num_tiles);
+                    for (auto& s : status)
+                    {
+                        s.data_.store(
+                            lookback_tile_not_ready, std::memory_order_relaxed);
+                    }
+                    std::atomic<std::size_t> next_tile(0);
+
+                    auto process_tiles = [&]() {
+                        for (std::size_t tile = next_tile++; tile < num_tiles;
+                             tile = next_tile++)
+                        {
+                            FwdIter it = tiles[tile];
+                            std::size_t size = (std::min)(
+                                tile_size, count - tile * tile_size);
+
+                            hpx::shared_future<Result1> curr =
+                                dataflow(hpx::launch::sync, f1, it, size);
+
+                            hpx::shared_future<Result1> prev;
+                            if (tile == 0)
+                            {
+                                prev = workitems[0];
+                            }
+                            else
+                            {
+                                aggregates[tile] = curr;
+                                status[tile].data_.store(
+                                    lookback_tile_aggregate,
+                                    std::memory_order_release);
+
+                                // combine the values published by the tiles
+                                // to the left until an inclusive prefix is
+                                // found
+                                for (std::size_t i = tile; i != 0; --i)
+                                {
+                                    int s = lookback_tile_not_ready;
+                                    hpx::util::yield_while([&]() {
+                                        s = status[i - 1].data_.load(
+                                            std::memory_order_acquire);
+                                        return s == lookback_tile_not_ready;
+                                    });
+
+                                    hpx::shared_future<Result1> value =
+                                        s == lookback_tile_aggregate ?
+                                        aggregates[i - 1] :
+                                        workitems[i];
+
+                                    if (prev.valid())
+                                    {
+                                        prev = dataflow(
+                                            hpx::launch::sync, f2, value, prev);
+                                    }
+                                    else
+                                    {
+                                        prev = value;
+                                    }
+
+                                    if (s != lookback_tile_aggregate)
+                                        break;
+                                }
+                            }
+
+                            workitems[tile + 1] =
+                                dataflow(hpx::launch::sync, f2, prev, curr);
+                            status[tile].data_.store(lookback_tile_prefix,
+                                std::memory_order_release);
+
+                            if (SequentialF3 && tile != 0)
+                            {
+                                hpx::util::yield_while([&]() {
+                                    return status[tile - 1].data_.load(
+                                               std::memory_order_acquire) !=
+                                        lookback_tile_f3_done;
+                                });
+                            }
+
+                            finalitems[tile] = dataflow(hpx::launch::sync, f3,
+                                it, size, prev, workitems[tile + 1]);
+
+                            if (SequentialF3)
+                            {
+                                status[tile].data_.store(lookback_tile_f3_done,
+                                    std::memory_order_release);
+                            }
+                        }
+                    };
+
+                    // run one of the tasks on this thread
+                    std::size_t const num_tasks = (std::min)(cores, num_tiles);
+
+                    std::vector<hpx::future<void>> tasks;
+                    tasks.reserve(num_tasks - 1);
+                    for (std::size_t i = 1; i < num_tasks; ++i)
+                    {
+                        tasks.push_back(execution::async_execute(
+                            policy.executor(), process_tiles));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+
+                    process_tiles();
+
+                    hpx::wait_all(tasks);
+                    handle_local_exceptions::call(tasks, errors, false);
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+                return reduce(std::move(workitems), std::move(finalitems),
+                    std::move(errors), std::forward<F4>(f4));
+#endif
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
                 T&& init, F1&& f1, F2&& f2, F3&& f3, F4&& f4)
             {
-                return call(ScanPartTag{}, std::forward<ExPolicy_>(policy),
-                    first, count, std::forward<T>(init), std::forward<F1>(f1),
+                using scan_partitioner_tag =
+                    typename select_scan_partitioner_tag<ScanPartTag,
+                        parameters_type>::type;
+
+                return call(scan_partitioner_tag{},
+                    std::forward<ExPolicy_>(policy), first, count,
+                    std::forward<T>(init), std::forward<F1>(f1),
                     std::forward<F2>(f2), std::forward<F3>(f3),
                     std::forward<F4>(f4));
             }
@@ -342,7 +583,7 @@ namespace hpx { namespace parallel { namespace util {
                         using partitioner_type =
                             scan_static_partitioner<ExPolicy, ScanPartTag, R,
                                 Result1, Result2>;
-                        return partitioner_type::call(ScanPartTag{},
+                        return partitioner_type::call(
                             std::forward<ExPolicy_>(policy), first, count,
                             std::move(init), f1, f2, f3, f4);
                     });
@@ -0,0 +1,224 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use small tiles to make sure that the tiles look back over a couple of
+// their predecessors
+std::size_t const tile_sizes[] = {0, 1, 7, 1000};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_lookback(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<std::size_t> dis(0, 100);
+
+    std::vector<std::size_t> c(10007);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t> e(c.size());
+
+    hpx::inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::plus<std::size_t>(),
+        std::size_t(42));
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e));
+    for (std::size_t& v : e)
+        v += 42;
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+
+    hpx::exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::size_t(42));
+    std::partial_sum(std::begin(c), std::end(c) - 1, std::begin(e) + 1);
+    e[0] = 0;
+    for (std::size_t& v : e)
+        v += 42;
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+
+    hpx::transform_inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), std::plus<std::size_t>(),
+        [](std::size_t v) { return 2 * v; });
+    std::transform(std::begin(c), std::end(c), std::begin(e),
+        [](std::size_t v) { return 2 * v; });
+    std::partial_sum(std::begin(e), std::end(e), std::begin(e));
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if_lookback(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<int> dis(-100, 100);
+    auto pred = [](int v) { return v < 0; };
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+    std::vector<int> d(c.size());
+    std::vector<int> e(c.size());
+
+    auto result = hpx::copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), pred);
+    auto expected =
+        std::copy_if(std::begin(c), std::end(c), std::begin(e), pred);
+
+    HPX_TEST_EQ(std::distance(std::begin(d), result),
+        std::distance(std::begin(e), expected));
+    HPX_TEST(std::equal(std::begin(d), result, std::begin(e)));
+
+    std::vector<int> d_true(c.size());
+    std::vector<int> d_false(c.size());
+    auto partitioned = hpx::parallel::partition_copy(policy,
+        iterator(std::begin(c)), iterator(std::end(c)), std::begin(d_true),
+        std::begin(d_false), pred);
+
+    std::vector<int> e_true(c.size());
+    std::vector<int> e_false(c.size());
+    auto expected_partitioned = std::partition_copy(std::begin(c),
+        std::end(c), std::begin(e_true), std::begin(e_false), pred);
+
+    HPX_TEST(std::equal(std::begin(d_true), hpx::get<1>(partitioned),
+        std::begin(e_true), expected_partitioned.first));
+    HPX_TEST(std::equal(std::begin(d_false), hpx::get<2>(partitioned),
+        std::begin(e_false), expected_partitioned.second));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_unique_lookback(ExPolicy&& policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<int> dis(0, 3);
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    std::vector<int> d = c;
+
+    // remove and unique run the final step sequentially from left to right
+    auto result =
+        hpx::remove(policy, iterator(std::begin(c)), iterator(std::end(c)), 0);
+    auto expected = std::remove(std::begin(d), std::end(d), 0);
+
+    HPX_TEST_EQ(std::distance(std::begin(c), result.base()),
+        std::distance(std::begin(d), expected));
+    HPX_TEST(std::equal(std::begin(c), result.base(), std::begin(d)));
+
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    d = c;
+
+    auto unique_result =
+        hpx::unique(policy, iterator(std::begin(c)), iterator(std::end(c)));
+    auto unique_expected = std::unique(std::begin(d), std::end(d));
+
+    HPX_TEST_EQ(std::distance(std::begin(c), unique_result.base()),
+        std::distance(std::begin(d), unique_expected));
+    HPX_TEST(std::equal(std::begin(c), unique_result.base(), std::begin(d)));
+}
+
+template <typename IteratorTag>
+void test_lookback()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t tile_size : tile_sizes)
+    {
+        lookback_scan lookback(tile_size);
+
+        test_scan_lookback(par.with(lookback), IteratorTag());
+        test_scan_lookback(
+            par.with(lookback, static_chunk_size(100)), IteratorTag());
+
+        test_copy_if_lookback(par.with(lookback), IteratorTag());
+        test_remove_unique_lookback(par.with(lookback), IteratorTag());
+    }
+}
+
+template <typename IteratorTag>
+void test_lookback_async()
+{
+    using namespace hpx::execution;
+
+    std::vector<std::size_t> c(10007, 1);
+    std::vector<std::size_t> d(c.size());
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    auto f = hpx::inclusive_scan(par(task).with(lookback_scan(13)),
+        iterator(std::begin(c)), iterator(std::end(c)), std::begin(d));
+    f.wait();
+
+    std::size_t expected = 0;
+    HPX_TEST(std::all_of(std::begin(d), std::end(d),
+        [&](std::size_t v) { return v == ++expected; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_lookback<std::random_access_iterator_tag>();
+    test_lookback<std::forward_iterator_tag>();
+
+    test_lookback_async<std::random_access_iterator_tag>();
+    test_lookback_async<std::forward_iterator_tag>();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -51,10 +51,7 @@ void for_each_zipiter_test(ExPolicy&& policy, IteratorTag)
     auto end = hpx::util::make_zip_iterator(
         iterator(std::end(c)), iterator(std::end(d)));
 
-    auto result =
-        hpx::for_each(std::forward<ExPolicy>(policy), begin, end, set_42());
-
-    HPX_TEST_EQ(result, end);
+    hpx::for_each(std::forward<ExPolicy>(policy), begin, end, set_42());
 
     // verify values
     std::size_t count = 0;
@@ -63,6 +60,13 @@ void for_each_zipiter_test(ExPolicy&& policy, IteratorTag)
         ++count;
     });
     HPX_TEST_EQ(count, c.size());
+
+    count = 0;
+    std::for_each(std::begin(d), std::end(d), [&count](int v) -> void {
+        HPX_TEST_EQ(v, int(42));
+        ++count;
+    });
+    HPX_TEST_EQ(count, d.size());
     /*
     auto begin = hpx::util::make_zip_iterator(
         iterator(std::begin(c)), iterator(std::begin(d)));
@@ -90,8 +94,8 @@ void for_each_zipiter_test()
 {
     using namespace hpx::execution;
 
-    for_each_zipiter_test(execution::datapar, IteratorTag());
-    //     test_for_each_async(execution::datapar(task), IteratorTag());
+    for_each_zipiter_test(hpx::execution::datapar, IteratorTag());
+    //     test_for_each_async(hpx::execution::datapar(task), IteratorTag());
 }
 
 void for_each_zipiter_test()
@@ -20,11 +20,11 @@ void test_transform_binary2()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2(execution::dataseq, IteratorTag());
-    test_transform_binary2(execution::datapar, IteratorTag());
+    test_transform_binary2(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary2(hpx::execution::datapar, IteratorTag());
 
-    test_transform_binary2_async(execution::dataseq(task), IteratorTag());
-    test_transform_binary2_async(execution::datapar(task), IteratorTag());
+    test_transform_binary2_async(hpx::execution::dataseq(task), IteratorTag());
+    test_transform_binary2_async(hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary2_test()
@@ -39,13 +39,13 @@ void test_transform_binary2_exception()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2_exception(execution::dataseq, IteratorTag());
-    test_transform_binary2_exception(execution::datapar, IteratorTag());
+    test_transform_binary2_exception(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary2_exception(hpx::execution::datapar, IteratorTag());
 
     test_transform_binary2_exception_async(
-        execution::dataseq(task), IteratorTag());
+        hpx::execution::dataseq(task), IteratorTag());
     test_transform_binary2_exception_async(
-        execution::datapar(task), IteratorTag());
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary2_exception_test()
@@ -60,13 +60,13 @@ void test_transform_binary2_bad_alloc()
 {
     using namespace hpx::execution;
 
-    test_transform_binary2_bad_alloc(execution::dataseq, IteratorTag());
-    test_transform_binary2_bad_alloc(execution::datapar, IteratorTag());
+    test_transform_binary2_bad_alloc(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary2_bad_alloc(hpx::execution::datapar, IteratorTag());
 
     test_transform_binary2_bad_alloc_async(
-        execution::dataseq(task), IteratorTag());
+        hpx::execution::dataseq(task), IteratorTag());
     test_transform_binary2_bad_alloc_async(
-        execution::datapar(task), IteratorTag());
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary2_bad_alloc_test()
@@ -20,11 +20,11 @@ void test_transform_binary()
 {
     using namespace hpx::execution;
 
-    test_transform_binary(execution::dataseq, IteratorTag());
-    test_transform_binary(execution::datapar, IteratorTag());
+    test_transform_binary(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary(hpx::execution::datapar, IteratorTag());
 
-    test_transform_binary_async(execution::dataseq(task), IteratorTag());
-    test_transform_binary_async(execution::datapar(task), IteratorTag());
+    test_transform_binary_async(hpx::execution::dataseq(task), IteratorTag());
+    test_transform_binary_async(hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary_test()
@@ -39,13 +39,13 @@ void test_transform_binary_exception()
 {
     using namespace hpx::execution;
 
-    test_transform_binary_exception(execution::dataseq, IteratorTag());
-    test_transform_binary_exception(execution::datapar, IteratorTag());
+    test_transform_binary_exception(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary_exception(hpx::execution::datapar, IteratorTag());
 
     test_transform_binary_exception_async(
-        execution::dataseq(task), IteratorTag());
+        hpx::execution::dataseq(task), IteratorTag());
     test_transform_binary_exception_async(
-        execution::datapar(task), IteratorTag());
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary_exception_test()
@@ -60,13 +60,13 @@ void test_transform_binary_bad_alloc()
 {
     using namespace hpx::execution;
 
-    test_transform_binary_bad_alloc(execution::dataseq, IteratorTag());
-    test_transform_binary_bad_alloc(execution::datapar, IteratorTag());
+    test_transform_binary_bad_alloc(hpx::execution::dataseq, IteratorTag());
+    test_transform_binary_bad_alloc(hpx::execution::datapar, IteratorTag());
 
     test_transform_binary_bad_alloc_async(
-        execution::dataseq(task), IteratorTag());
+        hpx::execution::dataseq(task), IteratorTag());
     test_transform_binary_bad_alloc_async(
-        execution::datapar(task), IteratorTag());
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_binary_bad_alloc_test()
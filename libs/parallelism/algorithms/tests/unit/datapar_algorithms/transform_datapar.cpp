@@ -20,11 +20,11 @@ void test_transform()
 {
     using namespace hpx::execution;
 
-    test_transform(execution::dataseq, IteratorTag());
-    test_transform(execution::datapar, IteratorTag());
+    test_transform(hpx::execution::dataseq, IteratorTag());
+    test_transform(hpx::execution::datapar, IteratorTag());
 
-    test_transform_async(execution::dataseq(task), IteratorTag());
-    test_transform_async(execution::datapar(task), IteratorTag());
+    test_transform_async(hpx::execution::dataseq(task), IteratorTag());
+    test_transform_async(hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_test()
@@ -38,11 +38,13 @@ void test_transform_exception()
 {
     using namespace hpx::execution;
 
-    test_transform_exception(execution::dataseq, IteratorTag());
-    test_transform_exception(execution::datapar, IteratorTag());
+    test_transform_exception(hpx::execution::dataseq, IteratorTag());
+    test_transform_exception(hpx::execution::datapar, IteratorTag());
 
-    test_transform_exception_async(execution::dataseq(task), IteratorTag());
-    test_transform_exception_async(execution::datapar(task), IteratorTag());
+    test_transform_exception_async(
+        hpx::execution::dataseq(task), IteratorTag());
+    test_transform_exception_async(
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_exception_test()
@@ -57,11 +59,13 @@ void test_transform_bad_alloc()
 {
     using namespace hpx::execution;
 
-    test_transform_bad_alloc(execution::dataseq, IteratorTag());
-    test_transform_bad_alloc(execution::datapar, IteratorTag());
+    test_transform_bad_alloc(hpx::execution::dataseq, IteratorTag());
+    test_transform_bad_alloc(hpx::execution::datapar, IteratorTag());
 
-    test_transform_bad_alloc_async(execution::dataseq(task), IteratorTag());
-    test_transform_bad_alloc_async(execution::datapar(task), IteratorTag());
+    test_transform_bad_alloc_async(
+        hpx::execution::dataseq(task), IteratorTag());
+    test_transform_bad_alloc_async(
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_bad_alloc_test()
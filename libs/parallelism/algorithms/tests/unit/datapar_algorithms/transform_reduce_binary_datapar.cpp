@@ -20,11 +20,13 @@ void test_transform_reduce_binary()
 {
     using namespace hpx::execution;
 
-    test_transform_reduce_binary(execution::dataseq, IteratorTag());
-    test_transform_reduce_binary(execution::datapar, IteratorTag());
+    test_transform_reduce_binary(hpx::execution::dataseq, IteratorTag());
+    test_transform_reduce_binary(hpx::execution::datapar, IteratorTag());
 
-    test_transform_reduce_binary_async(execution::dataseq(task), IteratorTag());
-    test_transform_reduce_binary_async(execution::datapar(task), IteratorTag());
+    test_transform_reduce_binary_async(
+        hpx::execution::dataseq(task), IteratorTag());
+    test_transform_reduce_binary_async(
+        hpx::execution::datapar(task), IteratorTag());
 }
 
 void transform_reduce_binary_test()
@@ -26,11 +26,12 @@ namespace hpx {
             sync = 0x08,
             fork = 0x10,    // same as async, but forces continuation stealing
             apply = 0x20,
+            adaptive = 0x40,    // same as async, but may run inline
 
             sync_policies = 0x0a,     // sync | deferred
-            async_policies = 0x15,    // async | task | fork
-            all = 0x3f                // async | deferred | task | sync |
-                                      // fork | apply
+            async_policies = 0x55,    // async | task | fork | adaptive
+            all = 0x7f                // async | deferred | task | sync |
+                                      // fork | apply | adaptive
         };
 
         struct policy_holder_base
@@ -181,6 +182,23 @@ namespace hpx {
             }
         };
 
+        struct adaptive_policy : policy_holder<adaptive_policy>
+        {
+            constexpr explicit adaptive_policy(
+                threads::thread_priority priority =
+                    threads::thread_priority_default) noexcept
+              : policy_holder<adaptive_policy>(
+                    launch_policy::adaptive, priority)
+            {
+            }
+
+            constexpr adaptive_policy operator()(
+                threads::thread_priority priority) const noexcept
+            {
+                return adaptive_policy(priority);
+            }
+        };
+
         struct sync_policy : policy_holder<sync_policy>
         {
             constexpr sync_policy() noexcept
@@ -371,6 +389,14 @@ namespace hpx {
         {
         }
 
+        /// Create a launch policy representing asynchronous execution. Short
+        /// continuations may be run directly on the thread which made
+        /// their predecessor ready
+        constexpr launch(detail::adaptive_policy) noexcept
+          : detail::policy_holder<>{detail::launch_policy::adaptive}
+        {
+        }
+
         /// Create a launch policy representing synchronous execution
         constexpr launch(detail::sync_policy) noexcept
           : detail::policy_holder<>{detail::launch_policy::sync}
@@ -400,6 +426,7 @@ namespace hpx {
         /// \cond NOINTERNAL
         using async_policy = detail::async_policy;
         using fork_policy = detail::fork_policy;
+        using adaptive_policy = detail::adaptive_policy;
         using sync_policy = detail::sync_policy;
         using deferred_policy = detail::deferred_policy;
         using apply_policy = detail::apply_policy;
@@ -415,6 +442,13 @@ namespace hpx {
         /// new thread is executed in a preferred way
         HPX_PARALLELISM_EXPORT static const detail::fork_policy fork;
 
+        /// Predefined launch policy representing asynchronous execution.
+        /// Continuations are run directly on the thread which made their
+        /// predecessor ready if the continuations created at the same place
+        /// were measured to be short and the recursion depth of directly
+        /// executed continuations permits it.
+        HPX_PARALLELISM_EXPORT static const detail::adaptive_policy adaptive;
+
         /// Predefined launch policy representing synchronous execution
         HPX_PARALLELISM_EXPORT static const detail::sync_policy sync;
 
@@ -453,6 +487,18 @@ namespace hpx {
             return bool(static_cast<int>(p.policy()) &
                 static_cast<int>(detail::launch_policy::async_policies));
         }
+
+        HPX_FORCEINLINE constexpr bool is_adaptive_policy(launch p) noexcept
+        {
+            return p.get_policy() == detail::launch_policy::adaptive;
+        }
+
+        template <typename F>
+        HPX_FORCEINLINE constexpr bool is_adaptive_policy(
+            detail::policy_holder<F> const& p) noexcept
+        {
+            return p.policy() == detail::launch_policy::adaptive;
+        }
     }    // namespace detail
     /// \endcond
 }    // namespace hpx
@@ -11,5 +11,6 @@
 #include <hpx/execution/executors/auto_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
+#include <hpx/execution/executors/lookback_scan.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
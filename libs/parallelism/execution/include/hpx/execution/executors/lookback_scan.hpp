@@ -0,0 +1,103 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/lookback_scan.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/type_support/decay.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects the single-pass scan for all scan based algorithms (for
+    /// instance inclusive_scan, exclusive_scan, copy_if, remove, unique, or
+    /// partition_copy).
+    ///
+    /// The input is divided into tiles of \a tile_size elements which are
+    /// processed by a fixed number of tasks (one per core). Each tile
+    /// publishes its partial aggregate as soon as it is known, the tiles to
+    /// its right combine the published values of their predecessors
+    /// (decoupled look-back) and apply the final step while the tile is still
+    /// in cache. This avoids building one dataflow graph node per chunk and
+    /// reads the input only once.
+    ///
+    /// \note This executor parameters type can be combined with other
+    ///       executor parameters, the chunk size related parameters are not
+    ///       used for the single-pass scan, though.
+    ///
+    struct lookback_scan
+    {
+        /// Construct a \a lookback_scan executor parameters object
+        ///
+        /// \note By default the tile size is determined from the number of
+        ///       available cores and the overall number of elements such
+        ///       that each tile fits into the level 2 cache.
+        ///
+        constexpr lookback_scan()
+          : tile_size_(0)
+        {
+        }
+
+        /// Construct a \a lookback_scan executor parameters object
+        ///
+        /// \param tile_size    [in] The number of elements processed as one
+        ///                     unit by the single-pass scan.
+        ///
+        constexpr explicit lookback_scan(std::size_t tile_size)
+          : tile_size_(tile_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_tile_size() const
+        {
+            return tile_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar& tile_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t tile_size_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::lookback_scan>
+      : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The joined executor parameters derive from all of the joined
+    // parameters types.
+    template <typename Parameters>
+    struct is_lookback_scan_parameters
+      : std::is_base_of<hpx::execution::lookback_scan,
+            typename hpx::util::decay_unwrap<Parameters>::type>
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
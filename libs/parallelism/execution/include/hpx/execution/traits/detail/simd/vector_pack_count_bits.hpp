@@ -0,0 +1,27 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t count_bits(
+        std::experimental::simd_mask<T, Abi> const& mask)
+    {
+        return static_cast<std::size_t>(std::experimental::popcount(mask));
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -26,6 +26,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/execution/traits/detail/vc/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_load_store.hpp>
 #endif
 
 #endif
@@ -20,6 +20,7 @@
 #include <hpx/functional/invoke_fused.hpp>
 #include <hpx/functional/traits/get_function_annotation.hpp>
 #include <hpx/functional/traits/is_action.hpp>
+#include <hpx/futures/detail/adaptive_continuation.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
@@ -74,8 +75,9 @@ namespace hpx { namespace lcos { namespace detail {
     struct dataflow_finalization
     {
         //
-        explicit dataflow_finalization(Frame* df)
+        explicit dataflow_finalization(Frame* df, bool timed = false)
           : this_(df)
+          , timed_(timed)
         {
         }
         using is_void = typename Frame::is_void;
@@ -83,11 +85,19 @@ namespace hpx { namespace lcos { namespace detail {
         template <typename Futures>
         void operator()(Futures&& futures) const
         {
+            adaptive_continuation_timer timer(timed_ ?
+                    &get_adaptive_continuation_cost<
+                        typename Frame::function_type>() :
+                    nullptr);
+
             return this_->execute(is_void{}, std::forward<Futures>(futures));
         }
 
         // keep the dataflow frame alive with this pointer reference
         hpx::intrusive_ptr<Frame> this_;
+
+        // measure the execution time for hpx::launch::adaptive
+        bool timed_;
     };
 
     template <typename F, typename Args>
@@ -251,6 +261,29 @@ namespace hpx { namespace lcos { namespace detail {
             exec.post(std::move(this_f_), std::move(futures));
         }
 
+        void finalize(hpx::detail::adaptive_policy policy, Futures&& futures)
+        {
+            adaptive_continuation_cost& cost =
+                get_adaptive_continuation_cost<Func>();
+
+            // Short functions are run directly on the thread which made the
+            // last of the futures ready.
+            if (run_adaptive_inline(cost))
+            {
+                hpx::util::annotate_function annotate(func_);
+                adaptive_continuation_timer timer(&cost);
+                execute(is_void{}, std::move(futures));
+                return;
+            }
+
+            detail::dataflow_finalization<dataflow_type> this_f_(this, true);
+
+            hpx::execution::parallel_policy_executor<launch::async_policy> exec{
+                launch::async_policy(policy.priority())};
+
+            exec.post(std::move(this_f_), std::move(futures));
+        }
+
         HPX_FORCEINLINE
         void finalize(hpx::detail::sync_policy, Futures&& futures)
         {
@@ -299,6 +332,10 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 finalize(launch::fork, std::move(futures));
             }
+            else if (policy == launch::adaptive)
+            {
+                finalize(launch::adaptive, std::move(futures));
+            }
             else
             {
                 finalize(launch::async, std::move(futures));
@@ -15,6 +15,7 @@
 #include <hpx/execution/traits/executor_traits.hpp>
 #include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/execution/traits/is_executor.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
 #include <hpx/executors/datapar/execution_policy_fwd.hpp>
 #include <hpx/executors/parallel_executor.hpp>
 #include <hpx/executors/sequenced_executor.hpp>
@@ -40,8 +41,8 @@ namespace hpx { namespace execution { inline namespace v1 {
 
         /// The type of the associated executor parameters object which is
         /// associated with this execution policy
-        typedef execution::extract_executor_parameters<executor_type>::type
-            executor_parameters_type;
+        typedef parallel::execution::extract_executor_parameters<
+            executor_type>::type executor_parameters_type;
 
         /// The category of the execution agents created by this execution
         /// policy.
@@ -88,8 +89,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new dataseq_task_policy
         ///
         template <typename Executor>
-        typename rebind_executor<dataseq_task_policy, Executor,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<dataseq_task_policy,
+            Executor, executor_parameters_type>::type
         on(Executor&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor>::value ||
@@ -97,7 +98,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor>::value || "
                 "hpx::traits::is_executor_any<Executor>::value");
 
-            typedef typename rebind_executor<dataseq_task_policy, Executor,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_task_policy, Executor,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor>(exec), parameters());
         }
@@ -119,15 +121,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters,
             typename ParametersType =
-                typename executor_parameters_join<Parameters...>::type>
-        typename rebind_executor<dataseq_task_policy, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters...>::type>
+        typename parallel::execution::rebind_executor<dataseq_task_policy,
+            executor_type, ParametersType>::type
         with(Parameters&&... params) const
         {
-            typedef typename rebind_executor<dataseq_task_policy, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_task_policy, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(executor(),
-                join_executor_parameters(std::forward<Parameters>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters>(params)...));
         }
 
     public:
@@ -229,8 +234,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new dataseq_task_policy_shim
         ///
         template <typename Executor_>
-        typename rebind_executor<dataseq_task_policy_shim, Executor_,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<dataseq_task_policy_shim,
+            Executor_, executor_parameters_type>::type
         on(Executor_&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor_>::value ||
@@ -238,8 +243,9 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor_>::value || "
                 "hpx::traits::is_executor_any<Executor_>::value");
 
-            typedef typename rebind_executor<dataseq_task_policy_shim,
-                Executor_, executor_parameters_type>::type rebound_type;
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_task_policy_shim, Executor_,
+                executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor_>(exec), params_);
         }
 
@@ -260,15 +266,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters_,
             typename ParametersType =
-                typename executor_parameters_join<Parameters_...>::type>
-        typename rebind_executor<dataseq_task_policy_shim, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters_...>::type>
+        typename parallel::execution::rebind_executor<dataseq_task_policy_shim,
+            executor_type, ParametersType>::type
         with(Parameters_&&... params) const
         {
-            typedef typename rebind_executor<dataseq_task_policy_shim,
-                executor_type, ParametersType>::type rebound_type;
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_task_policy_shim, executor_type,
+                ParametersType>::type rebound_type;
             return rebound_type(exec_,
-                join_executor_parameters(std::forward<Parameters_>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters_>(params)...));
         }
 
         /// Return the associated executor object.
@@ -330,8 +339,8 @@ namespace hpx { namespace execution { inline namespace v1 {
 
         /// The type of the associated executor parameters object which is
         /// associated with this execution policy
-        typedef execution::extract_executor_parameters<executor_type>::type
-            executor_parameters_type;
+        typedef parallel::execution::extract_executor_parameters<
+            executor_type>::type executor_parameters_type;
 
         /// The category of the execution agents created by this execution
         /// policy.
@@ -382,7 +391,7 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new dataseq_policy
         ///
         template <typename Executor>
-        typename rebind_executor<dataseq_policy, Executor,
+        typename parallel::execution::rebind_executor<dataseq_policy, Executor,
             executor_parameters_type>::type
         on(Executor&& exec) const
         {
@@ -391,7 +400,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor>::value || "
                 "hpx::traits::is_executor_any<Executor>::value");
 
-            typedef typename rebind_executor<dataseq_policy, Executor,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_policy, Executor,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor>(exec), parameters());
         }
@@ -413,15 +423,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters,
             typename ParametersType =
-                typename executor_parameters_join<Parameters...>::type>
-        typename rebind_executor<dataseq_policy, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters...>::type>
+        typename parallel::execution::rebind_executor<dataseq_policy,
+            executor_type, ParametersType>::type
         with(Parameters&&... params) const
         {
-            typedef typename rebind_executor<dataseq_policy, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_policy, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(executor(),
-                join_executor_parameters(std::forward<Parameters>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters>(params)...));
         }
 
     public:
@@ -521,8 +534,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new dataseq_policy
         ///
         template <typename Executor_>
-        typename rebind_executor<dataseq_policy_shim, Executor_,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<dataseq_policy_shim,
+            Executor_, executor_parameters_type>::type
         on(Executor_&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor_>::value ||
@@ -530,7 +543,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor_>::value || "
                 "hpx::traits::is_executor_any<Executor_>::value");
 
-            typedef typename rebind_executor<dataseq_policy_shim, Executor_,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_policy_shim, Executor_,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor_>(exec), params_);
         }
@@ -552,15 +566,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters_,
             typename ParametersType =
-                typename executor_parameters_join<Parameters_...>::type>
-        typename rebind_executor<dataseq_policy_shim, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters_...>::type>
+        typename parallel::execution::rebind_executor<dataseq_policy_shim,
+            executor_type, ParametersType>::type
         with(Parameters_&&... params) const
         {
-            typedef typename rebind_executor<dataseq_policy_shim, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                dataseq_policy_shim, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(exec_,
-                join_executor_parameters(std::forward<Parameters_>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters_>(params)...));
         }
 
         /// Return the associated executor object.
@@ -625,8 +642,8 @@ namespace hpx { namespace execution { inline namespace v1 {
 
         /// The type of the associated executor parameters object which is
         /// associated with this execution policy
-        typedef execution::extract_executor_parameters<executor_type>::type
-            executor_parameters_type;
+        typedef parallel::execution::extract_executor_parameters<
+            executor_type>::type executor_parameters_type;
 
         /// The category of the execution agents created by this execution
         /// policy.
@@ -672,8 +689,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new datapar_task_policy
         ///
         template <typename Executor>
-        typename rebind_executor<datapar_task_policy, Executor,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<datapar_task_policy,
+            Executor, executor_parameters_type>::type
         on(Executor&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor>::value ||
@@ -681,7 +698,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor>::value || "
                 "hpx::traits::is_executor_any<Executor>::value");
 
-            typedef typename rebind_executor<datapar_task_policy, Executor,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_task_policy, Executor,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor>(exec), parameters());
         }
@@ -703,15 +721,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters,
             typename ParametersType =
-                typename executor_parameters_join<Parameters...>::type>
-        typename rebind_executor<datapar_task_policy, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters...>::type>
+        typename parallel::execution::rebind_executor<datapar_task_policy,
+            executor_type, ParametersType>::type
         with(Parameters&&... params) const
         {
-            typedef typename rebind_executor<datapar_task_policy, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_task_policy, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(executor(),
-                join_executor_parameters(std::forward<Parameters>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters>(params)...));
         }
 
     public:
@@ -761,8 +782,8 @@ namespace hpx { namespace execution { inline namespace v1 {
 
         /// The type of the associated executor parameters object which is
         /// associated with this execution policy
-        typedef execution::extract_executor_parameters<executor_type>::type
-            executor_parameters_type;
+        typedef parallel::execution::extract_executor_parameters<
+            executor_type>::type executor_parameters_type;
 
         /// The category of the execution agents created by this execution
         /// policy.
@@ -808,7 +829,7 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new datapar_policy
         ///
         template <typename Executor>
-        typename rebind_executor<datapar_policy, Executor,
+        typename parallel::execution::rebind_executor<datapar_policy, Executor,
             executor_parameters_type>::type
         on(Executor&& exec) const
         {
@@ -817,7 +838,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor>::value || "
                 "hpx::traits::is_executor_any<Executor>::value");
 
-            typedef typename rebind_executor<datapar_policy, Executor,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_policy, Executor,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor>(exec), parameters());
         }
@@ -838,15 +860,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters,
             typename ParametersType =
-                typename executor_parameters_join<Parameters...>::type>
-        typename rebind_executor<datapar_policy, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters...>::type>
+        typename parallel::execution::rebind_executor<datapar_policy,
+            executor_type, ParametersType>::type
         with(Parameters&&... params) const
         {
-            typedef typename rebind_executor<datapar_policy, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_policy, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(executor(),
-                join_executor_parameters(std::forward<Parameters>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters>(params)...));
         }
 
     public:
@@ -945,8 +970,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new parallel_policy
         ///
         template <typename Executor_>
-        typename rebind_executor<datapar_policy_shim, Executor_,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<datapar_policy_shim,
+            Executor_, executor_parameters_type>::type
         on(Executor_&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor_>::value ||
@@ -954,7 +979,8 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor_>::value || "
                 "hpx::traits::is_executor_any<Executor_>::value");
 
-            typedef typename rebind_executor<datapar_policy_shim, Executor_,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_policy_shim, Executor_,
                 executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor_>(exec), params_);
         }
@@ -975,15 +1001,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters_,
             typename ParametersType =
-                typename executor_parameters_join<Parameters_...>::type>
-        typename rebind_executor<datapar_policy_shim, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters_...>::type>
+        typename parallel::execution::rebind_executor<datapar_policy_shim,
+            executor_type, ParametersType>::type
         with(Parameters_&&... params) const
         {
-            typedef typename rebind_executor<datapar_policy_shim, executor_type,
+            typedef typename parallel::execution::rebind_executor<
+                datapar_policy_shim, executor_type,
                 ParametersType>::type rebound_type;
             return rebound_type(exec_,
-                join_executor_parameters(std::forward<Parameters_>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters_>(params)...));
         }
 
         /// Return the associated executor object.
@@ -1090,8 +1119,8 @@ namespace hpx { namespace execution { inline namespace v1 {
         /// \returns The new parallel_task_policy
         ///
         template <typename Executor_>
-        typename rebind_executor<datapar_task_policy_shim, Executor_,
-            executor_parameters_type>::type
+        typename parallel::execution::rebind_executor<datapar_task_policy_shim,
+            Executor_, executor_parameters_type>::type
         on(Executor_&& exec) const
         {
             static_assert(hpx::traits::is_threads_executor<Executor_>::value ||
@@ -1099,8 +1128,9 @@ namespace hpx { namespace execution { inline namespace v1 {
                 "hpx::traits::is_threads_executor<Executor_>::value || "
                 "hpx::traits::is_executor_any<Executor_>::value");
 
-            typedef typename rebind_executor<datapar_task_policy_shim,
-                Executor_, executor_parameters_type>::type rebound_type;
+            typedef typename parallel::execution::rebind_executor<
+                datapar_task_policy_shim, Executor_,
+                executor_parameters_type>::type rebound_type;
             return rebound_type(std::forward<Executor_>(exec), params_);
         }
 
@@ -1121,15 +1151,18 @@ namespace hpx { namespace execution { inline namespace v1 {
         ///
         template <typename... Parameters_,
             typename ParametersType =
-                typename executor_parameters_join<Parameters_...>::type>
-        typename rebind_executor<datapar_task_policy_shim, executor_type,
-            ParametersType>::type
+                typename parallel::execution::executor_parameters_join<
+                    Parameters_...>::type>
+        typename parallel::execution::rebind_executor<datapar_task_policy_shim,
+            executor_type, ParametersType>::type
         with(Parameters_&&... params) const
         {
-            typedef typename rebind_executor<datapar_task_policy_shim,
-                executor_type, ParametersType>::type rebound_type;
+            typedef typename parallel::execution::rebind_executor<
+                datapar_task_policy_shim, executor_type,
+                ParametersType>::type rebound_type;
             return rebound_type(exec_,
-                join_executor_parameters(std::forward<Parameters_>(params)...));
+                parallel::execution::join_executor_parameters(
+                    std::forward<Parameters_>(params)...));
         }
 
         /// Return the associated executor object.
@@ -1282,13 +1315,15 @@ namespace hpx { namespace detail {
     };
 
     template <>
-    struct is_async_execution_policy<datapar_task_policy> : std::true_type
+    struct is_async_execution_policy<hpx::execution::datapar_task_policy>
+      : std::true_type
     {
     };
 
     template <typename Executor, typename Parameters>
     struct is_async_execution_policy<
-        datapar_task_policy_shim<Executor, Parameters>> : std::true_type
+        hpx::execution::datapar_task_policy_shim<Executor, Parameters>>
+      : std::true_type
     {
     };
     /// \endcond
@@ -1296,24 +1331,28 @@ namespace hpx { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
     /// \cond NOINTERNAL
     template <>
-    struct is_parallel_execution_policy<datapar_policy> : std::true_type
+    struct is_parallel_execution_policy<hpx::execution::datapar_policy>
+      : std::true_type
     {
     };
 
     template <>
-    struct is_parallel_execution_policy<datapar_task_policy> : std::true_type
+    struct is_parallel_execution_policy<hpx::execution::datapar_task_policy>
+      : std::true_type
     {
     };
 
     template <typename Executor, typename Parameters>
     struct is_parallel_execution_policy<
-        datapar_policy_shim<Executor, Parameters>> : std::true_type
+        hpx::execution::datapar_policy_shim<Executor, Parameters>>
+      : std::true_type
     {
     };
 
     template <typename Executor, typename Parameters>
     struct is_parallel_execution_policy<
-        datapar_task_policy_shim<Executor, Parameters>> : std::true_type
+        hpx::execution::datapar_task_policy_shim<Executor, Parameters>>
+      : std::true_type
     {
     };
     /// \endcond
@@ -1347,24 +1386,28 @@ namespace hpx { namespace detail {
     };
 
     template <>
-    struct is_vectorpack_execution_policy<datapar_policy> : std::true_type
+    struct is_vectorpack_execution_policy<hpx::execution::datapar_policy>
+      : std::true_type
     {
     };
 
     template <>
-    struct is_vectorpack_execution_policy<datapar_task_policy> : std::true_type
+    struct is_vectorpack_execution_policy<hpx::execution::datapar_task_policy>
+      : std::true_type
     {
     };
 
     template <typename Executor, typename Parameters>
     struct is_vectorpack_execution_policy<
-        datapar_policy_shim<Executor, Parameters>> : std::true_type
+        hpx::execution::datapar_policy_shim<Executor, Parameters>>
+      : std::true_type
     {
     };
 
     template <typename Executor, typename Parameters>
     struct is_vectorpack_execution_policy<
-        datapar_task_policy_shim<Executor, Parameters>> : std::true_type
+        hpx::execution::datapar_task_policy_shim<Executor, Parameters>>
+      : std::true_type
     {
     };
     /// \endcond
@@ -0,0 +1,246 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/deadline_executor.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/traits/is_executor.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/futures_factory.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a deadline_executor creates threads which carry an absolute
+    /// deadline (see threads::thread_init_data::deadline). The deadline is
+    /// either given as a point in time or as a time budget which is added to
+    /// the current time whenever a new thread is created.
+    ///
+    /// The deadline is honored by schedulers supporting it (currently the
+    /// local_deadline_queue_scheduler, --hpx:queuing=local-deadline), which
+    /// run the threads in earliest deadline first order and count the
+    /// threads finishing after their deadline. All other schedulers ignore
+    /// the deadline, i.e. this executor behaves like a parallel_executor in
+    /// this case.
+    ///
+    /// This executor conforms to the concepts of a NonBlockingOneWayExecutor
+    /// and a TwoWayExecutor.
+    struct deadline_executor
+    {
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        using execution_category = parallel_execution_tag;
+
+        /// Associate the static_chunk_size executor parameters type as a
+        /// default with this executor.
+        using executor_parameters_type = static_chunk_size;
+
+        /// Create a new deadline executor assigning the deadline
+        /// 'now + \a rel_time' to each created thread
+        explicit deadline_executor(hpx::chrono::steady_duration const& rel_time,
+            threads::thread_priority priority =
+                threads::thread_priority_default,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize_default,
+            threads::thread_schedule_hint schedulehint = {})
+          : pool_(nullptr)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+          , deadline_(0)
+          , budget_(to_nanoseconds(rel_time.value()))
+        {
+        }
+
+        /// Create a new deadline executor assigning the deadline \a abs_time
+        /// to all created threads
+        explicit deadline_executor(
+            hpx::chrono::steady_time_point const& abs_time,
+            threads::thread_priority priority =
+                threads::thread_priority_default,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize_default,
+            threads::thread_schedule_hint schedulehint = {})
+          : pool_(nullptr)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+          , deadline_(to_nanoseconds(abs_time.value().time_since_epoch()))
+          , budget_(0)
+        {
+        }
+
+        /// Create a new deadline executor creating the threads on the given
+        /// thread pool
+        deadline_executor(threads::thread_pool_base* pool,
+            hpx::chrono::steady_duration const& rel_time,
+            threads::thread_priority priority =
+                threads::thread_priority_default,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize_default,
+            threads::thread_schedule_hint schedulehint = {})
+          : pool_(pool)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+          , deadline_(0)
+          , budget_(to_nanoseconds(rel_time.value()))
+        {
+        }
+
+        deadline_executor(threads::thread_pool_base* pool,
+            hpx::chrono::steady_time_point const& abs_time,
+            threads::thread_priority priority =
+                threads::thread_priority_default,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize_default,
+            threads::thread_schedule_hint schedulehint = {})
+          : pool_(pool)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+          , deadline_(to_nanoseconds(abs_time.value().time_since_epoch()))
+          , budget_(0)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
+                stacksize_ == rhs.stacksize_ &&
+                schedulehint_ == rhs.schedulehint_ &&
+                deadline_ == rhs.deadline_ && budget_ == rhs.budget_;
+        }
+
+        bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        deadline_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// Return the deadline (hpx::chrono::high_resolution_clock, in
+        /// nanoseconds) a thread created now would be assigned.
+        std::uint64_t get_deadline() const
+        {
+            if (deadline_ != 0)
+                return deadline_;
+            return hpx::chrono::high_resolution_clock::now() + budget_;
+        }
+
+        /// \cond NOINTERNAL
+
+        // NonBlockingOneWayExecutor interface
+        template <typename F, typename... Ts>
+        void post(F&& f, Ts&&... ts) const
+        {
+            hpx::util::thread_description desc(f);
+
+            post_impl(desc,
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type>
+        async_execute(F&& f, Ts&&... ts) const
+        {
+            using result_type =
+                typename hpx::util::detail::invoke_deferred_result<F,
+                    Ts...>::type;
+
+            hpx::util::thread_description desc(f);
+
+            lcos::local::futures_factory<result_type()> p(
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+            hpx::future<result_type> result = p.get_future();
+
+            post_impl(desc, std::move(p));
+
+            return result;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename Rep, typename Period>
+        static std::uint64_t to_nanoseconds(
+            std::chrono::duration<Rep, Period> const& d)
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(d)
+                    .count());
+        }
+
+        template <typename F>
+        void post_impl(hpx::util::thread_description const& desc, F&& f) const
+        {
+            auto pool =
+                pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary(std::forward<F>(f)),
+                desc, priority_, schedulehint_, stacksize_, threads::pending);
+            data.deadline = get_deadline();
+
+            threads::register_work(data, pool);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        threads::thread_pool_base* pool_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+        threads::thread_schedule_hint schedulehint_;
+
+        // either an absolute deadline or the budget added to the current
+        // time whenever a thread is created
+        std::uint64_t deadline_;
+        std::uint64_t budget_;
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_never_blocking_one_way_executor<
+        hpx::execution::experimental::deadline_executor> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_two_way_executor<hpx::execution::experimental::deadline_executor>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -17,14 +17,18 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
@@ -35,6 +39,48 @@
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
+    // Launch the elements [part_begin, part_end) of the shape starting at
+    // 'it'. Asynchronous threads are handed to the scheduler at once instead
+    // of registering them one by one.
+    template <typename Result, typename Iter, typename F, typename... Ts>
+    void bulk_async_execute_part(threads::thread_pool_base* pool,
+        threads::thread_priority priority, threads::thread_stacksize stacksize,
+        threads::thread_schedule_hint hint, launch policy,
+        hpx::util::thread_description const& desc,
+        std::vector<hpx::future<Result>>& results, std::size_t part_begin,
+        std::size_t part_end, Iter& it, F& f, Ts&... ts)
+    {
+        if (policy != launch::async)
+        {
+            for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+            {
+                results[part_i] =
+                    hpx::detail::async_launch_policy_dispatch<decltype(
+                        policy)>::call(policy, pool, priority, stacksize, hint,
+                        f, *it, ts...);
+                ++it;
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(part_end - part_begin);
+
+        for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+        {
+            lcos::local::futures_factory<Result()> p(
+                hpx::util::deferred_call(f, *it, ts...));
+            results[part_i] = p.get_future();
+
+            data.emplace_back(threads::make_thread_function_nullary(
+                                  [p = std::move(p)]() { p(); }),
+                desc, priority, hint, stacksize, threads::pending);
+            ++it;
+        }
+
+        threads::register_threads_bulk(data, pool);
+    }
+
     template <typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
@@ -75,15 +121,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     desc, pool, priority, threads::thread_stacksize_small, hint,
                     [&, hint, part_begin, part_end, part_size, f,
                         it]() mutable {
-                        for (std::size_t part_i = part_begin; part_i < part_end;
-                             ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    decltype(policy)>::call(policy, pool,
-                                    priority, stacksize, hint, f, *it, ts...);
-                            ++it;
-                        }
+                        bulk_async_execute_part(pool, priority, stacksize,
+                            hint, policy, desc, results, part_begin, part_end,
+                            it, f, ts...);
                         l.count_down(part_size);
                     });
 
@@ -91,15 +131,9 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             }
             else
             {
-                for (std::size_t part_i = part_begin; part_i < part_end;
-                     ++part_i)
-                {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<decltype(
-                            policy)>::call(policy, pool, priority, stacksize,
-                            hint, f, *it, ts...);
-                    ++it;
-                }
+                bulk_async_execute_part(pool, priority, stacksize, hint,
+                    policy, desc, results, part_begin, part_end, it, f,
+                    ts...);
                 l.count_down(part_size);
             }
 
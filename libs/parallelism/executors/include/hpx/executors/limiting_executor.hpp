@@ -13,15 +13,23 @@
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/detail/invoke.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/print.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -39,6 +47,39 @@ namespace hpx { namespace execution { namespace experimental {
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(in_flight_estimate)
     }    // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Parameters of a limiting_executor adapting its limit of tasks 'in
+    // flight' to the observed task latency (the time between a task being
+    // admitted and its completion). After each window of completed tasks the
+    // given percentile of their latencies is compared to the target latency.
+    // The limit is decreased multiplicatively if the target was missed and
+    // increased additively otherwise, provided the limit was reached during
+    // that window (AIMD).
+    struct adaptive_limit_parameters
+    {
+        explicit adaptive_limit_parameters(
+            std::chrono::nanoseconds target_latency)
+          : target_latency_(target_latency)
+        {
+        }
+
+        // the latency the given percentile of tasks should not exceed
+        std::chrono::nanoseconds target_latency_;
+        double percentile_ = 0.9;
+
+        std::size_t initial_limit_ = 64;
+        std::size_t min_limit_ = 1;
+        std::size_t max_limit_ = std::size_t(-1);
+
+        // the limit is increased by this amount if the target was met
+        std::size_t increase_ = 1;
+        // the limit is multiplied by this factor if the target was missed
+        double decrease_ = 0.75;
+
+        // the number of completed tasks considered for each adjustment
+        std::size_t window_ = 64;
+    };
+
     template <typename BaseExecutor>
     struct limiting_executor
     {
@@ -49,16 +90,18 @@ namespace hpx { namespace execution { namespace experimental {
         // --------------------------------------------------------------------
         struct on_exit
         {
-            on_exit(limiting_executor const& this_e)
+            on_exit(limiting_executor const& this_e, std::uint64_t admitted)
               : executor_(this_e)
+              , admitted_(admitted)
             {
             }
             ~on_exit()
             {
                 lim_debug.debug(hpx::debug::str<>("Count Down"));
-                executor_.count_down();
+                executor_.count_down(admitted_);
             }
             limiting_executor const& executor_;
+            std::uint64_t admitted_;
         };
 
         // --------------------------------------------------------------------
@@ -73,46 +116,46 @@ namespace hpx { namespace execution { namespace experimental {
         struct throttling_wrapper
         {
             throttling_wrapper(
-                limiting_executor& lim, BaseExecutor const& base, F&& f)
+                limiting_executor const& lim, BaseExecutor const& base, F&& f)
               : limiting_(lim)
               , f_(std::forward<F>(f))
+              , admitted_(0)
             {
                 limiting_.count_up();
                 if (exceeds_upper())
                 {
                     lim_debug.debug(hpx::debug::str<>("Exceeds_upper"));
-                    hpx::util::yield_while([&]() { return exceeds_lower(); });
+                    limiting_.wait_for_lower();
                     lim_debug.debug(hpx::debug::str<>("Below_lower"));
                 }
+                admitted_ = limiting_.admitted();
             }
 
             // when task completes, on_exit destructor calls count_down
             template <typename... Ts>
             decltype(auto) operator()(Ts&&... ts)
             {
-                on_exit _{limiting_};
+                on_exit _{limiting_, admitted_};
                 return HPX_INVOKE(f_, std::forward<Ts>(ts)...);
             }
 
             // returns true if too many tasks would be in flight
             // NB. we use ">" because we count up right before testing
-            bool exceeds_upper()
+            bool exceeds_upper() const
             {
                 return (limiting_.count_ > limiting_.upper_threshold_);
             }
-            // returns true if we have not yet reached the lower threshold
-            bool exceeds_lower()
-            {
-                return (limiting_.count_ > limiting_.lower_threshold_);
-            }
 
-            limiting_executor& limiting_;
+            limiting_executor const& limiting_;
             F f_;
+            std::uint64_t admitted_;
         };
 
         // this is a specialized wrapper struct that skips count up / down
         // and uses the underlying executor to get a count of tasks
-        // 'in flight' for the throttling.
+        // 'in flight' for the throttling. As task completions are not
+        // observed, producers yield until enough tasks have completed and
+        // the limit is not adapted.
         // The dummy B template param must match BaseExecutor and helps
         // deduction rules complete this type so that the default implementation
         // (above) still works
@@ -175,7 +218,10 @@ namespace hpx { namespace execution { namespace experimental {
           , lower_threshold_(lower)
           , upper_threshold_(upper)
           , block_(block_on_destruction)
+          , adaptive_(false)
+          , params_(std::chrono::nanoseconds(0))
         {
+            init_statistics();
         }
 
         limiting_executor(std::size_t lower, std::size_t upper,
@@ -185,7 +231,40 @@ namespace hpx { namespace execution { namespace experimental {
           , lower_threshold_(lower)
           , upper_threshold_(upper)
           , block_(block_on_destruction)
+          , adaptive_(false)
+          , params_(std::chrono::nanoseconds(0))
         {
+            init_statistics();
+        }
+
+        // --------------------------------------------------------------------
+        // adaptive mode: the limit of tasks 'in flight' starts at
+        // params.initial_limit_ and is adjusted to meet the target latency
+        limiting_executor(BaseExecutor& ex,
+            adaptive_limit_parameters const& params,
+            bool block_on_destruction = true)
+          : executor_(ex)
+          , count_(0)
+          , lower_threshold_(params.initial_limit_)
+          , upper_threshold_(params.initial_limit_)
+          , block_(block_on_destruction)
+          , adaptive_(true)
+          , params_(params)
+        {
+            init_statistics();
+        }
+
+        limiting_executor(adaptive_limit_parameters const& params,
+            bool block_on_destruction = true)
+          : executor_(BaseExecutor{})
+          , count_(0)
+          , lower_threshold_(params.initial_limit_)
+          , upper_threshold_(params.initial_limit_)
+          , block_(block_on_destruction)
+          , adaptive_(true)
+          , params_(params)
+        {
+            init_statistics();
         }
 
         // --------------------------------------------------------------------
@@ -268,32 +347,172 @@ namespace hpx { namespace execution { namespace experimental {
         // drops to the lower threshold
         void wait()
         {
-            hpx::util::yield_while(
-                [&]() { return (count_ > lower_threshold_); });
+            wait_until([&]() { return !(count_ > lower_threshold_); });
         }
 
         // --------------------------------------------------------------------
         // wait (suspend) until all tasks launched on this executor have completed
         void wait_all()
         {
-            hpx::util::yield_while([&]() { return (count_ > 0); });
+            wait_until([&]() { return !(count_ > 0); });
         }
 
         void set_threshold(std::size_t lower, std::size_t upper)
         {
             lower_threshold_ = lower;
             upper_threshold_ = upper;
+            notify_waiting();
+        }
+
+        // --------------------------------------------------------------------
+        // statistics, the signatures allow to expose these directly as
+        // performance counters (see performance_counters::install_counter_type)
+
+        // the current limit of tasks 'in flight'
+        std::int64_t get_limit(bool /*reset*/ = false) const
+        {
+            return static_cast<std::int64_t>(upper_threshold_.load());
+        }
+
+        // the average time [ns] tasks were held back before being passed to
+        // the underlying executor since the last reset
+        std::int64_t get_queueing_delay(bool reset = false) const
+        {
+            std::int64_t const delay = reset ?
+                queueing_delay_.exchange(0) :
+                queueing_delay_.load();
+            std::int64_t const tasks =
+                reset ? num_tasks_.exchange(0) : num_tasks_.load();
+            return tasks == 0 ? 0 : delay / tasks;
+        }
+
+        // the latency percentile [ns] measured over the last complete window
+        // of tasks (adaptive mode only)
+        std::int64_t get_latency(bool /*reset*/ = false) const
+        {
+            return latency_.load();
         }
 
     private:
-        void count_up()
+        void init_statistics()
+        {
+            waiting_ = 0;
+            queueing_delay_ = 0;
+            num_tasks_ = 0;
+            latency_ = 0;
+            saturated_ = false;
+            if (adaptive_)
+                samples_.reserve(params_.window_);
+        }
+
+        void count_up() const
         {
             ++count_;
+            ++num_tasks_;
         }
 
-        void count_down() const
+        // the admission time of a task, only needed in adaptive mode
+        std::uint64_t admitted() const
         {
-            --count_;
+            return adaptive_ ? hpx::chrono::high_resolution_clock::now() : 0;
+        }
+
+        void count_down(std::uint64_t admitted) const
+        {
+            if (adaptive_)
+            {
+                adapt_limit(
+                    hpx::chrono::high_resolution_clock::now() - admitted);
+            }
+
+            if (--count_ <= lower_threshold_ && waiting_ != 0)
+            {
+                notify_waiting();
+            }
+        }
+
+        // called by producers if the limit was exceeded
+        void wait_for_lower() const
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            saturated_ = true;
+
+            wait_until([&]() { return !(count_ > lower_threshold_); });
+
+            queueing_delay_ += static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - start);
+        }
+
+        // suspend the calling HPX thread until the predicate is satisfied,
+        // fall back to yielding if called from outside of HPX
+        template <typename Predicate>
+        void wait_until(Predicate&& pred) const
+        {
+            if (threads::get_self_ptr() == nullptr)
+            {
+                hpx::util::yield_while([&]() { return !pred(); });
+                return;
+            }
+
+            // waiting_ is incremented before the predicate is evaluated
+            // under the lock, count_down either observes it or decrements
+            // the count before the predicate is evaluated
+            ++waiting_;
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (!pred())
+                {
+                    cond_.wait(l, "limiting_executor::wait");
+                }
+            }
+            --waiting_;
+        }
+
+        void notify_waiting() const
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            cond_.notify_all(std::move(l));
+        }
+
+        void adapt_limit(std::uint64_t latency) const
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            samples_.push_back(latency);
+            if (samples_.size() < params_.window_)
+                return;
+
+            std::size_t const n = static_cast<std::size_t>(
+                params_.percentile_ * double(samples_.size() - 1));
+            std::nth_element(
+                samples_.begin(), samples_.begin() + n, samples_.end());
+            std::uint64_t const percentile = samples_[n];
+            latency_ = static_cast<std::int64_t>(percentile);
+            samples_.clear();
+
+            std::size_t const limit = upper_threshold_;
+            std::size_t new_limit = limit;
+            if (percentile > std::uint64_t(params_.target_latency_.count()))
+            {
+                new_limit = (std::max)(params_.min_limit_,
+                    static_cast<std::size_t>(limit * params_.decrease_));
+            }
+            else if (saturated_ && limit < params_.max_limit_)
+            {
+                new_limit = limit + (std::min)(params_.increase_,
+                                        params_.max_limit_ - limit);
+            }
+            saturated_ = false;
+
+            lower_threshold_ = new_limit;
+            upper_threshold_ = new_limit;
+
+            // producers may proceed if the limit was increased
+            if (new_limit > limit && waiting_ != 0)
+            {
+                cond_.notify_all(std::move(l));
+            }
         }
 
         void set_and_wait(std::size_t lower, std::size_t upper)
@@ -303,12 +522,30 @@ namespace hpx { namespace execution { namespace experimental {
         }
 
     private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
         // --------------------------------------------------------------------
         BaseExecutor executor_;
         mutable std::atomic<std::size_t> count_;
-        mutable std::size_t lower_threshold_;
-        mutable std::size_t upper_threshold_;
+        mutable std::atomic<std::size_t> lower_threshold_;
+        mutable std::atomic<std::size_t> upper_threshold_;
         bool block_;
+
+        // producers waiting for tasks to complete
+        mutable mutex_type mtx_;
+        mutable hpx::lcos::local::detail::condition_variable cond_;
+        mutable std::atomic<std::size_t> waiting_;
+
+        // statistics
+        mutable std::atomic<std::int64_t> queueing_delay_;
+        mutable std::atomic<std::int64_t> num_tasks_;
+        mutable std::atomic<std::int64_t> latency_;
+
+        // adaptive mode
+        bool const adaptive_;
+        adaptive_limit_parameters const params_;
+        mutable std::vector<std::uint64_t> samples_;
+        mutable std::atomic<bool> saturated_;
     };
 }}}    // namespace hpx::execution::experimental
 
@@ -0,0 +1,192 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/tenant_executor.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+#include <hpx/execution/traits/is_executor.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/tenant.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace execution { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a tenant_executor wraps another executor and associates all threads
+    /// created through it with the given tenant (see threads::register_tenant).
+    /// Threads created by those threads inherit the tenant.
+    ///
+    /// The tenant is honored by schedulers supporting fair-share scheduling
+    /// (currently the local_fair_share_queue_scheduler,
+    /// --hpx:queuing=fair-share), which divide the processing time of a
+    /// thread pool between the tenants according to their weights. All
+    /// other schedulers ignore the tenant, i.e. this executor behaves like
+    /// the wrapped executor in this case.
+    ///
+    /// The wrapped executor is expected to create its threads without
+    /// suspending the calling thread.
+    template <typename BaseExecutor>
+    struct tenant_executor
+    {
+        using execution_category = typename BaseExecutor::execution_category;
+        using executor_parameters_type =
+            typename BaseExecutor::executor_parameters_type;
+
+        tenant_executor(BaseExecutor const& exec, threads::tenant_id tenant)
+          : exec_(exec)
+          , tenant_(tenant)
+        {
+        }
+
+        tenant_executor(BaseExecutor&& exec, threads::tenant_id tenant)
+          : exec_(std::move(exec))
+          , tenant_(tenant)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(tenant_executor const& rhs) const noexcept
+        {
+            return exec_ == rhs.exec_ && tenant_ == rhs.tenant_;
+        }
+
+        bool operator!=(tenant_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        tenant_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// Return the tenant the created threads are associated with
+        threads::tenant_id get_tenant() const noexcept
+        {
+            return tenant_;
+        }
+
+        /// Return the wrapped executor
+        BaseExecutor const& get_executor() const noexcept
+        {
+            return exec_;
+        }
+
+        /// \cond NOINTERNAL
+
+        // OneWayExecutor interface, the function is run by a thread of the
+        // tenant and the calling thread waits for it to finish
+        template <typename F, typename... Ts>
+        decltype(auto) sync_execute(F&& f, Ts&&... ts) const
+        {
+            return async_execute(std::forward<F>(f), std::forward<Ts>(ts)...)
+                .get();
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        decltype(auto) async_execute(F&& f, Ts&&... ts) const
+        {
+            threads::scoped_tenant t(tenant_);
+            return hpx::parallel::execution::async_execute(
+                exec_, std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // NonBlockingOneWayExecutor interface
+        template <typename F, typename... Ts>
+        void post(F&& f, Ts&&... ts) const
+        {
+            threads::scoped_tenant t(tenant_);
+            hpx::parallel::execution::post(
+                exec_, std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        template <typename F, typename S, typename... Ts>
+        decltype(auto) bulk_async_execute(
+            F&& f, S const& shape, Ts&&... ts) const
+        {
+            threads::scoped_tenant t(tenant_);
+            return hpx::parallel::execution::bulk_async_execute(
+                exec_, std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        BaseExecutor exec_;
+        threads::tenant_id tenant_;
+        /// \endcond
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return an executor creating its threads through \a exec on behalf of
+    /// the given tenant.
+    template <typename BaseExecutor>
+    tenant_executor<typename std::decay<BaseExecutor>::type> with_tenant(
+        BaseExecutor&& exec, threads::tenant_id tenant)
+    {
+        return tenant_executor<typename std::decay<BaseExecutor>::type>(
+            std::forward<BaseExecutor>(exec), tenant);
+    }
+
+    /// Return an executor creating its threads through \a exec on behalf of
+    /// the tenant with the given name. The tenant is registered with the
+    /// given weight (see threads::register_tenant).
+    template <typename BaseExecutor>
+    tenant_executor<typename std::decay<BaseExecutor>::type> with_tenant(
+        BaseExecutor&& exec, std::string const& name, std::uint32_t weight = 1)
+    {
+        return tenant_executor<typename std::decay<BaseExecutor>::type>(
+            std::forward<BaseExecutor>(exec),
+            threads::register_tenant(name, weight));
+    }
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <typename BaseExecutor>
+    struct is_one_way_executor<
+        hpx::execution::experimental::tenant_executor<BaseExecutor>>
+      : is_two_way_executor<typename std::decay<BaseExecutor>::type>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_never_blocking_one_way_executor<
+        hpx::execution::experimental::tenant_executor<BaseExecutor>>
+      : is_never_blocking_one_way_executor<
+            typename std::decay<BaseExecutor>::type>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_two_way_executor<
+        hpx::execution::experimental::tenant_executor<BaseExecutor>>
+      : is_two_way_executor<typename std::decay<BaseExecutor>::type>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_bulk_two_way_executor<
+        hpx::execution::experimental::tenant_executor<BaseExecutor>>
+      : is_bulk_two_way_executor<typename std::decay<BaseExecutor>::type>
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
+#include <hpx/config/warnings_suffix.hpp>
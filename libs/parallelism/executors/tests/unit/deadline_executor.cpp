@@ -0,0 +1,131 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/executors/deadline_executor.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::execution::experimental::deadline_executor;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async_execute()
+{
+    deadline_executor exec(std::chrono::seconds(1));
+
+    hpx::future<int> f = hpx::async(exec, [](int i) { return i + 1; }, 41);
+    HPX_TEST_EQ(f.get(), 42);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::async(exec, []() { throw std::runtime_error("error"); }).get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// All threads are created while the only worker thread is busy, the threads
+// must run in the order of their deadlines.
+void test_earliest_deadline_first()
+{
+    std::size_t const num_tasks = 10;
+
+    std::vector<std::size_t> order;
+    order.reserve(2 * num_tasks);
+
+    hpx::lcos::local::latch l(2 * num_tasks + 1);
+
+    auto const now = std::chrono::steady_clock::now();
+    for (std::size_t i = num_tasks; i != 0; --i)
+    {
+        // threads without deadline run after all threads with a deadline
+        hpx::apply([&, i]() {
+            order.push_back(num_tasks + i);
+            l.count_down(1);
+        });
+
+        deadline_executor exec(now + std::chrono::seconds(i));
+        hpx::apply(exec, [&, i]() {
+            order.push_back(i);
+            l.count_down(1);
+        });
+    }
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(order.size(), 2 * num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        HPX_TEST_EQ(order[i], i + 1);
+    }
+}
+
+void test_missed_deadlines()
+{
+    auto& pool = hpx::resource::get_thread_pool("default");
+
+    // reset the counters
+    pool.get_num_missed_deadlines(std::size_t(-1), true);
+    pool.get_average_deadline_lateness(std::size_t(-1), true);
+
+    // the deadline has already passed when the threads finish
+    deadline_executor past(
+        std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    deadline_executor future(std::chrono::hours(1));
+
+    std::vector<hpx::future<void>> tasks;
+    for (int i = 0; i != 5; ++i)
+    {
+        tasks.push_back(hpx::async(past, []() {}));
+        tasks.push_back(hpx::async(future, []() {}));
+    }
+    hpx::wait_all(tasks);
+
+    // threads are destroyed asynchronously after their future became ready
+    hpx::util::yield_while([&]() {
+        return pool.get_num_missed_deadlines(std::size_t(-1), false) < 5;
+    });
+
+    HPX_TEST_EQ(pool.get_num_missed_deadlines(std::size_t(-1), false),
+        std::int64_t(5));
+    HPX_TEST_LTE(std::int64_t(1000000),
+        pool.get_average_deadline_lateness(std::size_t(-1), false));
+}
+
+int hpx_main()
+{
+    test_async_execute();
+    test_earliest_deadline_first();
+    test_missed_deadlines();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the order of execution is verified on a single worker thread
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.scheduler=local-deadline"};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -11,8 +11,12 @@
 #include <hpx/include/parallel_executors.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <iostream>
 #include <random>
 #include <string>
 #include <vector>
@@ -100,10 +104,64 @@ void test_limit()
     // HPX_TEST_LTE(task_1_max, max1 + hpx::get_num_worker_threads());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void busy_wait(std::chrono::microseconds d)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < d)
+    {
+    }
+}
+
+// the latency of the tasks grows with the number of tasks in flight, the
+// executor must reduce its initial (much too large) limit to meet the target
+void test_adaptive_limit()
+{
+    auto exec =
+        hpx::execution::parallel_executor(hpx::threads::thread_stacksize_small);
+
+    hpx::execution::experimental::adaptive_limit_parameters params(
+        std::chrono::milliseconds(2));
+    params.initial_limit_ = 1000;
+    params.window_ = 32;
+
+    std::size_t const num_tasks = 5000;
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    {
+        hpx::execution::experimental::limiting_executor<decltype(exec)> lexec(
+            exec, params);
+        HPX_TEST_EQ(lexec.get_limit(), std::int64_t(1000));
+
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            futures.push_back(hpx::async(
+                lexec, &busy_wait, std::chrono::microseconds(100)));
+        }
+
+        // each worker thread runs ~20 tasks within the target latency
+        std::int64_t const max_limit =
+            std::int64_t(100 * hpx::get_num_worker_threads());
+        std::cout << "Adaptive limit " << lexec.get_limit() << " (latency "
+                  << lexec.get_latency() << " ns, queueing delay "
+                  << lexec.get_queueing_delay() << " ns)" << std::endl;
+
+        HPX_TEST_LT(lexec.get_limit(), max_limit);
+        HPX_TEST_LTE(std::int64_t(params.min_limit_), lexec.get_limit());
+        HPX_TEST_LT(std::int64_t(0), lexec.get_queueing_delay(true));
+        HPX_TEST_EQ(lexec.get_queueing_delay(), std::int64_t(0));
+    }
+
+    auto not_ready = std::count_if(
+        futures.begin(), futures.end(), [](auto& f) { return !f.is_ready(); });
+    HPX_TEST_EQ(not_ready, 0);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
     test_limit();
+    test_adaptive_limit();
 
     return hpx::finalize();
 }
@@ -0,0 +1,148 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/executors/tenant_executor.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::execution::parallel_executor;
+using hpx::execution::experimental::with_tenant;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_tenant()
+{
+    hpx::threads::tenant_id a = hpx::threads::register_tenant("a", 2);
+    HPX_TEST_NEQ(a, hpx::threads::default_tenant);
+    HPX_TEST_EQ(hpx::threads::get_tenant_id("a"), a);
+    HPX_TEST_EQ(hpx::threads::get_tenant_name(a), std::string("a"));
+    HPX_TEST_EQ(hpx::threads::get_tenant_weight(a), std::uint32_t(2));
+
+    // registering an existing tenant updates its weight
+    HPX_TEST_EQ(hpx::threads::register_tenant("a", 3), a);
+    HPX_TEST_EQ(hpx::threads::get_tenant_weight(a), std::uint32_t(3));
+    HPX_TEST_LT(std::size_t(a), hpx::threads::get_num_tenants());
+
+    hpx::error_code ec(hpx::lightweight);
+    hpx::threads::register_tenant("b", 0, ec);
+    HPX_TEST(ec);
+
+    hpx::threads::get_tenant_id("unknown", ec);
+    HPX_TEST(ec);
+}
+
+void test_tenant_inheritance()
+{
+    auto exec = with_tenant(parallel_executor(), "inherit");
+    hpx::threads::tenant_id const tenant = exec.get_tenant();
+
+    HPX_TEST_EQ(
+        hpx::threads::get_current_tenant(), hpx::threads::default_tenant);
+
+    hpx::future<hpx::threads::tenant_id> f = hpx::async(exec, []() {
+        // threads created by threads of a tenant inherit the tenant
+        return hpx::async([]() { return hpx::threads::get_current_tenant(); })
+            .get();
+    });
+    HPX_TEST_EQ(f.get(), tenant);
+
+    HPX_TEST_EQ(hpx::parallel::execution::sync_execute(
+                    exec, []() { return hpx::threads::get_current_tenant(); }),
+        tenant);
+
+    // the tenant of the calling thread is not changed
+    HPX_TEST_EQ(
+        hpx::threads::get_current_tenant(), hpx::threads::default_tenant);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void busy_wait(std::chrono::microseconds d)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < d)
+    {
+    }
+}
+
+// The threads of two tenants with different weights compete for the only
+// worker thread, the tenant with the larger weight must get the larger share
+// of the processing time.
+void test_fair_share()
+{
+    std::size_t const num_tasks = 100;
+    auto const duration = std::chrono::microseconds(500);
+
+    auto heavy = with_tenant(parallel_executor(), "heavy", 3);
+    auto light = with_tenant(parallel_executor(), "light", 1);
+
+    auto& pool = hpx::resource::get_thread_pool("default");
+    pool.get_tenant_cpu_time(heavy.get_tenant(), std::size_t(-1), true);
+    pool.get_tenant_cpu_time(light.get_tenant(), std::size_t(-1), true);
+
+    std::atomic<std::size_t> heavy_done(0);
+    std::atomic<std::size_t> light_done(0);
+    std::atomic<std::size_t> light_done_at_heavy_finish(0);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(2 * num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(light, [&]() {
+            busy_wait(duration);
+            ++light_done;
+        }));
+        tasks.push_back(hpx::async(heavy, [&]() {
+            busy_wait(duration);
+            if (++heavy_done == num_tasks)
+                light_done_at_heavy_finish = light_done.load();
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    // ideally one third of the threads of the light tenant have run when
+    // the heavy tenant finishes
+    HPX_TEST_LT(light_done_at_heavy_finish.load(), num_tasks / 2);
+
+    std::int64_t const heavy_time =
+        pool.get_tenant_cpu_time(heavy.get_tenant(), std::size_t(-1), false);
+    std::int64_t const light_time =
+        pool.get_tenant_cpu_time(light.get_tenant(), std::size_t(-1), false);
+
+    std::int64_t const expected = num_tasks * 500000;
+    HPX_TEST_LTE(expected, heavy_time);
+    HPX_TEST_LTE(expected, light_time);
+}
+
+int hpx_main()
+{
+    test_register_tenant();
+    test_tenant_inheritance();
+    test_fair_share();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the processing time is divided between the tenants on a single worker
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.scheduler=fair-share"};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace lcos { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Execution time of the continuations created at one call site with
+    // hpx::launch::adaptive, the exponentially weighted moving average of
+    // all measurements is kept.
+    struct adaptive_continuation_cost
+    {
+        constexpr adaptive_continuation_cost() noexcept
+          : average_(0)
+        {
+        }
+
+        std::uint64_t get() const noexcept
+        {
+            return average_.load(std::memory_order_relaxed);
+        }
+
+        bool is_cheap() const noexcept
+        {
+            return get() < HPX_ADAPTIVE_CONTINUATION_THRESHOLD;
+        }
+
+        // concurrent updates may get lost, which is fine for a heuristic
+        void update(std::uint64_t elapsed) noexcept
+        {
+            std::uint64_t const average = get();
+            average_.store(average - average / 8 + elapsed / 8,
+                std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::uint64_t> average_;
+    };
+
+    // The continuation type identifies the call site.
+    template <typename F>
+    adaptive_continuation_cost& get_adaptive_continuation_cost() noexcept
+    {
+        static adaptive_continuation_cost cost;
+        return cost;
+    }
+
+    // Time spent in timed continuations which were directly executed by the
+    // continuation currently being timed on this OS thread.
+    HPX_PARALLELISM_EXPORT std::uint64_t&
+    get_adaptive_continuation_nested_time() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decide whether a continuation launched with hpx::launch::adaptive is
+    // executed directly. This is never done on non-HPX threads.
+    inline bool run_adaptive_inline(adaptive_continuation_cost const& cost)
+    {
+        if (threads::get_self_ptr() == nullptr)
+            return false;
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        if (!this_thread::has_sufficient_stack_space())
+            return false;
+#endif
+        return threads::get_continuation_recursion_count() <
+            HPX_ADAPTIVE_CONTINUATION_MAX_RECURSION_DEPTH &&
+            cost.is_cheap();
+    }
+
+    // Measure the execution time of a continuation, excluding the time spent
+    // in timed continuations it executes directly. Nothing is measured if no
+    // cost object is given.
+    class adaptive_continuation_timer
+    {
+    public:
+        explicit adaptive_continuation_timer(
+            adaptive_continuation_cost* cost) noexcept
+          : cost_(cost)
+          , start_(0)
+          , outer_nested_time_(0)
+        {
+            if (cost_ != nullptr)
+            {
+                std::uint64_t& nested = get_adaptive_continuation_nested_time();
+                outer_nested_time_ = nested;
+                nested = 0;
+                start_ = hpx::chrono::high_resolution_clock::now();
+            }
+        }
+
+        ~adaptive_continuation_timer()
+        {
+            if (cost_ != nullptr)
+            {
+                std::uint64_t const elapsed =
+                    hpx::chrono::high_resolution_clock::now() - start_;
+
+                std::uint64_t& nested = get_adaptive_continuation_nested_time();
+                cost_->update(elapsed > nested ? elapsed - nested : 0);
+                nested = outer_nested_time_ + elapsed;
+            }
+        }
+
+        adaptive_continuation_timer(
+            adaptive_continuation_timer const&) = delete;
+        adaptive_continuation_timer& operator=(
+            adaptive_continuation_timer const&) = delete;
+
+    private:
+        adaptive_continuation_cost* cost_;
+        std::uint64_t start_;
+        std::uint64_t outer_nested_time_;
+    };
+}}}    // namespace hpx::lcos::detail
@@ -11,6 +11,7 @@
 #include <hpx/allocator_support/allocator_deleter.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/futures/detail/adaptive_continuation.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -257,6 +258,7 @@ namespace hpx { namespace lcos { namespace detail {
         // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
         continuation(Func&& f)
           : started_(false)
+          , adaptive_(false)
           , id_(threads::invalid_thread_id)
           , f_(std::forward<Func>(f))
         {
@@ -266,15 +268,25 @@ namespace hpx { namespace lcos { namespace detail {
         continuation(init_no_addref no_addref, Func&& f)
           : base_type(no_addref)
           , started_(false)
+          , adaptive_(false)
           , id_(threads::invalid_thread_id)
           , f_(std::forward<Func>(f))
         {
         }
 
     protected:
+        static adaptive_continuation_cost& adaptive_cost() noexcept
+        {
+            return get_adaptive_continuation_cost<
+                typename std::decay<F>::type>();
+        }
+
         void run_impl(
             typename traits::detail::shared_state_ptr_for<Future>::type&& f)
         {
+            adaptive_continuation_timer timer(
+                adaptive_ ? &adaptive_cost() : nullptr);
+
             Future future = traits::future_access<Future>::create(std::move(f));
             invoke_continuation(f_, std::move(future), *this);
         }
@@ -285,6 +297,9 @@ namespace hpx { namespace lcos { namespace detail {
             using is_void =
                 std::is_void<typename util::invoke_result<F, Future>::type>;
 
+            adaptive_continuation_timer timer(
+                adaptive_ ? &adaptive_cost() : nullptr);
+
             Future future = traits::future_access<Future>::create(std::move(f));
             invoke_continuation_nounwrap(
                 f_, std::move(future), *this, is_void{});
@@ -339,6 +354,8 @@ namespace hpx { namespace lcos { namespace detail {
             typename traits::detail::shared_state_ptr_for<Future>::type&& f)
         {
             reset_id r(*this);
+            adaptive_continuation_timer timer(
+                adaptive_ ? &adaptive_cost() : nullptr);
 
             Future future = traits::future_access<Future>::create(std::move(f));
             invoke_continuation(f_, std::move(future), *this);
@@ -351,6 +368,8 @@ namespace hpx { namespace lcos { namespace detail {
                 std::is_void<typename util::invoke_result<F, Future>::type>;
 
             reset_id r(*this);
+            adaptive_continuation_timer timer(
+                adaptive_ ? &adaptive_cost() : nullptr);
 
             Future future = traits::future_access<Future>::create(std::move(f));
             invoke_continuation_nounwrap(
@@ -497,12 +516,16 @@ namespace hpx { namespace lcos { namespace detail {
                     "the future to attach has no valid shared state");
             }
 
+            adaptive_ = hpx::detail::is_adaptive_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
                 [this_ = std::move(this_), state = std::move(state),
                     policy = std::forward<Policy>(policy),
                     &spawner]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (hpx::detail::has_async_policy(policy) &&
+                        !(this_->adaptive_ &&
+                            run_adaptive_inline(adaptive_cost())))
                     {
                         this_->async(std::move(state), spawner);
                     }
@@ -533,12 +556,16 @@ namespace hpx { namespace lcos { namespace detail {
                     "the future to attach has no valid shared state");
             }
 
+            adaptive_ = hpx::detail::is_adaptive_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
                 [this_ = std::move(this_), state = std::move(state),
                     policy = std::forward<Policy>(policy),
                     spawner = std::move(spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (hpx::detail::has_async_policy(policy) &&
+                        !(this_->adaptive_ &&
+                            run_adaptive_inline(adaptive_cost())))
                     {
                         this_->async(std::move(state), spawner);
                     }
@@ -570,12 +597,16 @@ namespace hpx { namespace lcos { namespace detail {
                     "the future to attach has no valid shared state");
             }
 
+            adaptive_ = hpx::detail::is_adaptive_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
                 [this_ = std::move(this_), state = std::move(state),
                     policy = std::forward<Policy>(policy),
                     &spawner]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (hpx::detail::has_async_policy(policy) &&
+                        !(this_->adaptive_ &&
+                            run_adaptive_inline(adaptive_cost())))
                     {
                         this_->async_nounwrap(std::move(state), spawner);
                     }
@@ -606,12 +637,16 @@ namespace hpx { namespace lcos { namespace detail {
                     "the future to attach has no valid shared state");
             }
 
+            adaptive_ = hpx::detail::is_adaptive_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
                 [this_ = std::move(this_), state = std::move(state),
                     policy = std::forward<Policy>(policy),
                     spawner = std::move(spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (hpx::detail::has_async_policy(policy) &&
+                        !(this_->adaptive_ &&
+                            run_adaptive_inline(adaptive_cost())))
                     {
                         this_->async_nounwrap(std::move(state), spawner);
                     }
@@ -624,6 +659,7 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         bool started_;
+        bool adaptive_;    // launched with hpx::launch::adaptive
         threads::thread_id_type id_;
         typename std::decay<F>::type f_;
     };
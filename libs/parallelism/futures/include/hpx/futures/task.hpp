@@ -0,0 +1,520 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/futures/task.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/assert.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/futures/traits/is_future.hpp>
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+
+    template <typename T = void>
+    class task;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The coroutine frames of tasks are recycled through free lists kept
+        // for each OS thread, sorted into size classes. Allocating and
+        // freeing a frame never suspends, so the calling HPX thread can't
+        // migrate to another OS thread while a free list is being used.
+        class task_frame_pool
+        {
+        public:
+            static constexpr std::size_t granularity = 64;
+            static constexpr std::size_t num_size_classes = 16;
+            static constexpr std::size_t max_cached_frames = 256;
+
+            static void* allocate(std::size_t size)
+            {
+                std::size_t const size_class = get_size_class(size);
+                if (size_class >= num_size_classes)
+                    return allocator_type{}.allocate(size);
+
+                free_list& list = get_free_lists()[size_class];
+                if (list.head_ == nullptr)
+                {
+                    return allocator_type{}.allocate(
+                        (size_class + 1) * granularity);
+                }
+
+                node* n = list.head_;
+                list.head_ = n->next_;
+                --list.count_;
+                return n;
+            }
+
+            static void deallocate(void* p, std::size_t size) noexcept
+            {
+                std::size_t const size_class = get_size_class(size);
+                if (size_class >= num_size_classes)
+                {
+                    allocator_type{}.deallocate(static_cast<char*>(p), size);
+                    return;
+                }
+
+                free_list& list = get_free_lists()[size_class];
+                if (list.count_ == max_cached_frames)
+                {
+                    allocator_type{}.deallocate(static_cast<char*>(p),
+                        (size_class + 1) * granularity);
+                    return;
+                }
+
+                node* n = static_cast<node*>(p);
+                n->next_ = list.head_;
+                list.head_ = n;
+                ++list.count_;
+            }
+
+        private:
+            using allocator_type = hpx::util::internal_allocator<char>;
+
+            struct node
+            {
+                node* next_;
+            };
+
+            struct free_list
+            {
+                ~free_list()
+                {
+                    while (head_ != nullptr)
+                    {
+                        node* n = head_;
+                        head_ = n->next_;
+                        allocator_type{}.deallocate(
+                            reinterpret_cast<char*>(n), size_);
+                    }
+                }
+
+                node* head_ = nullptr;
+                std::size_t count_ = 0;
+                std::size_t size_ = 0;
+            };
+
+            static std::size_t get_size_class(std::size_t size) noexcept
+            {
+                return (size + granularity - 1) / granularity - 1;
+            }
+
+            static free_list* get_free_lists() noexcept
+            {
+                thread_local free_list lists[num_size_classes];
+                if (lists[0].size_ == 0)
+                {
+                    for (std::size_t i = 0; i != num_size_classes; ++i)
+                        lists[i].size_ = (i + 1) * granularity;
+                }
+                return lists;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Resume the given coroutine on a new stackless HPX thread
+        inline void resume_on_stackless_thread(std::coroutine_handle<> h)
+        {
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary([h]() { h.resume(); }),
+                util::thread_description("hpx::task"),
+                threads::thread_priority_normal,
+                threads::thread_schedule_hint(),
+                threads::thread_stacksize_nostack);
+            threads::register_work_plain(data);
+        }
+
+        struct resume_stackless_awaiter
+        {
+            constexpr bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> h) const
+            {
+                resume_on_stackless_thread(h);
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        // Waiting for a future inside of a task doesn't block, the task is
+        // resumed on a stackless HPX thread once the future has become ready
+        template <typename Future>
+        struct task_future_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return f_.is_ready();
+            }
+
+            void await_suspend(std::coroutine_handle<> h)
+            {
+                auto st = traits::detail::get_shared_state(f_);
+                st->set_on_completed([h]() { resume_on_stackless_thread(h); });
+            }
+
+            decltype(auto) await_resume()
+            {
+                return f_.get();
+            }
+
+            Future& f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class task_promise_base
+        {
+        public:
+            struct final_awaiter
+            {
+                constexpr bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                // continue with the awaiting coroutine without growing the
+                // stack (symmetric transfer)
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<Promise> h) const noexcept
+                {
+                    std::coroutine_handle<> continuation =
+                        h.promise().continuation_;
+                    if (continuation)
+                        return continuation;
+                    return std::noop_coroutine();
+                }
+
+                constexpr void await_resume() const noexcept {}
+            };
+
+            // tasks are lazy, they start running only once awaited
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception_ = std::current_exception();
+            }
+
+            template <typename Future,
+                typename Enable = typename std::enable_if<traits::is_future<
+                    typename std::decay<Future>::type>::value>::type>
+            task_future_awaiter<typename std::remove_reference<Future>::type>
+            await_transform(Future&& f) noexcept
+            {
+                return {f};
+            }
+
+            template <typename Awaitable,
+                typename Enable = typename std::enable_if<!traits::is_future<
+                    typename std::decay<Awaitable>::type>::value>::type>
+            Awaitable&& await_transform(Awaitable&& a) noexcept
+            {
+                return std::forward<Awaitable>(a);
+            }
+
+            HPX_NODISCARD static void* operator new(std::size_t size)
+            {
+                return task_frame_pool::allocate(size);
+            }
+
+            static void operator delete(void* p, std::size_t size) noexcept
+            {
+                task_frame_pool::deallocate(p, size);
+            }
+
+            std::coroutine_handle<> continuation_;
+
+        protected:
+            void rethrow_if_exception() const
+            {
+                if (exception_)
+                    std::rethrow_exception(exception_);
+            }
+
+            std::exception_ptr exception_;
+        };
+
+        template <typename T>
+        class task_promise : public task_promise_base
+        {
+        public:
+            task<T> get_return_object() noexcept;
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                value_.emplace(std::forward<U>(value));
+            }
+
+            T get()
+            {
+                rethrow_if_exception();
+                HPX_ASSERT(value_.has_value());
+                return std::move(*value_);
+            }
+
+        private:
+            hpx::util::optional<T> value_;
+        };
+
+        template <>
+        class task_promise<void> : public task_promise_base
+        {
+        public:
+            task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void get() const
+            {
+                rethrow_if_exception();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hpx::task<T> is the result of a coroutine which produces a value of
+    /// type T. In contrast to coroutines returning a hpx::future<T>, a task
+    /// does not allocate a shared state and does not start running before it
+    /// is awaited. Awaiting a task from another task transfers control to it
+    /// directly, without involving the scheduler and without using stack
+    /// memory for deep chains of awaiting tasks. The coroutine frames are
+    /// allocated from a pool.
+    ///
+    /// Awaiting a hpx::future inside a task suspends the task, it is resumed
+    /// on a new stackless HPX thread once the future has become ready. Tasks
+    /// should therefore never block their thread (for instance by calling
+    /// future::get), but use co_await instead.
+    ///
+    /// Tasks are started by awaiting them or by hpx::spawn, which runs the
+    /// task on a stackless HPX thread and returns a future for its result.
+    template <typename T>
+    class task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+
+    private:
+        struct awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return !h_ || h_.done();
+            }
+
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<> awaiting) noexcept
+            {
+                h_.promise().continuation_ = awaiting;
+                return h_;
+            }
+
+            T await_resume()
+            {
+                HPX_ASSERT(h_);
+                return h_.promise().get();
+            }
+
+            std::coroutine_handle<promise_type> h_;
+        };
+
+    public:
+        task() noexcept = default;
+
+        explicit task(std::coroutine_handle<promise_type> h) noexcept
+          : h_(h)
+        {
+        }
+
+        task(task&& rhs) noexcept
+          : h_(rhs.h_)
+        {
+            rhs.h_ = nullptr;
+        }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (h_)
+                    h_.destroy();
+                h_ = rhs.h_;
+                rhs.h_ = nullptr;
+            }
+            return *this;
+        }
+
+        task(task const&) = delete;
+        task& operator=(task const&) = delete;
+
+        ~task()
+        {
+            if (h_)
+                h_.destroy();
+        }
+
+        /// Returns whether this task refers to a coroutine
+        bool valid() const noexcept
+        {
+            return static_cast<bool>(h_);
+        }
+
+        /// Returns whether the coroutine of this task has run to completion
+        bool is_ready() const noexcept
+        {
+            return h_ && h_.done();
+        }
+
+        /// A task can be awaited only once, its result is moved out
+        awaiter operator co_await() && noexcept
+        {
+            return awaiter{h_};
+        }
+
+        awaiter operator co_await() & noexcept
+        {
+            return awaiter{h_};
+        }
+
+    private:
+        std::coroutine_handle<promise_type> h_ = nullptr;
+    };
+
+    namespace detail {
+
+        template <typename T>
+        task<T> task_promise<T>::get_return_object() noexcept
+        {
+            return task<T>(
+                std::coroutine_handle<task_promise<T>>::from_promise(*this));
+        }
+
+        inline task<void> task_promise<void>::get_return_object() noexcept
+        {
+            return task<void>(
+                std::coroutine_handle<task_promise<void>>::from_promise(
+                    *this));
+        }
+    }    // namespace detail
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A coroutine which starts running immediately and frees its frame
+        // once it has run to completion
+        struct detached_task
+        {
+            struct promise_type
+            {
+                detached_task get_return_object() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                void return_void() const noexcept {}
+
+                void unhandled_exception() const noexcept
+                {
+                    std::terminate();
+                }
+
+                HPX_NODISCARD static void* operator new(std::size_t size)
+                {
+                    return task_frame_pool::allocate(size);
+                }
+
+                static void operator delete(void* p, std::size_t size) noexcept
+                {
+                    task_frame_pool::deallocate(p, size);
+                }
+            };
+        };
+
+        template <typename T>
+        detached_task run_task(task<T> t, lcos::local::promise<T> p)
+        {
+            co_await resume_stackless_awaiter{};
+            try
+            {
+                p.set_value(co_await std::move(t));
+            }
+            catch (...)
+            {
+                p.set_exception(std::current_exception());
+            }
+        }
+
+        inline detached_task run_task(
+            task<void> t, lcos::local::promise<void> p)
+        {
+            co_await resume_stackless_awaiter{};
+            try
+            {
+                co_await std::move(t);
+                p.set_value();
+            }
+            catch (...)
+            {
+                p.set_exception(std::current_exception());
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Start running the given task on a stackless HPX thread.
+    ///
+    /// \returns A future which becomes ready once the task has finished.
+    template <typename T>
+    hpx::future<T> spawn(task<T> t)
+    {
+        lcos::local::promise<T> p;
+        hpx::future<T> f = p.get_future();
+        detail::run_task(std::move(t), std::move(p));
+        return f;
+    }
+}    // namespace hpx
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
@@ -0,0 +1,18 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/futures/detail/adaptive_continuation.hpp>
+
+#include <cstdint>
+
+namespace hpx { namespace lcos { namespace detail {
+    std::uint64_t& get_adaptive_continuation_nested_time() noexcept
+    {
+        static thread_local std::uint64_t nested_time = 0;
+        return nested_time;
+    }
+}}}    // namespace hpx::lcos::detail
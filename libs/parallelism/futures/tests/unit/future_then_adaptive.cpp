@@ -0,0 +1,128 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void busy_wait(std::chrono::microseconds duration)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < duration)
+    {
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cheap_then()
+{
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<hpx::threads::thread_id_type> f =
+            p.get_future().then(hpx::launch::adaptive, [](hpx::future<int>&&) {
+                return hpx::threads::get_self_id();
+            });
+
+        // the continuation is executed directly by set_value
+        p.set_value(42);
+        HPX_TEST(f.is_ready());
+        HPX_TEST_EQ(f.get(), hpx::threads::get_self_id());
+    }
+}
+
+void test_expensive_then()
+{
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<hpx::threads::thread_id_type> f =
+            p.get_future().then(hpx::launch::adaptive, [](hpx::future<int>&&) {
+                busy_wait(std::chrono::microseconds(100));
+                return hpx::threads::get_self_id();
+            });
+
+        p.set_value(42);
+
+        // the first execution is measured, all others are run on a new thread
+        hpx::threads::thread_id_type id = f.get();
+        if (i != 0)
+        {
+            HPX_TEST_NEQ(id, hpx::threads::get_self_id());
+        }
+    }
+}
+
+void test_cheap_dataflow()
+{
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<hpx::threads::thread_id_type> f = hpx::dataflow(
+            hpx::launch::adaptive,
+            [](hpx::future<int>&&) { return hpx::threads::get_self_id(); },
+            p.get_future());
+
+        p.set_value(42);
+        HPX_TEST(f.is_ready());
+        HPX_TEST_EQ(f.get(), hpx::threads::get_self_id());
+    }
+}
+
+void test_expensive_dataflow()
+{
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<hpx::threads::thread_id_type> f = hpx::dataflow(
+            hpx::launch::adaptive,
+            [](hpx::future<int>&&) {
+                busy_wait(std::chrono::microseconds(100));
+                return hpx::threads::get_self_id();
+            },
+            p.get_future());
+
+        p.set_value(42);
+
+        hpx::threads::thread_id_type id = f.get();
+        if (i != 0)
+        {
+            HPX_TEST_NEQ(id, hpx::threads::get_self_id());
+        }
+    }
+}
+
+void test_async_adaptive()
+{
+    hpx::future<int> f = hpx::async(hpx::launch::adaptive, []() { return 42; });
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_cheap_then();
+    test_expensive_then();
+    test_cheap_dataflow();
+    test_expensive_dataflow();
+    test_async_adaptive();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
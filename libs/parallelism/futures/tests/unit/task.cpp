@@ -0,0 +1,99 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/futures/task.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> value(int i)
+{
+    co_return i;
+}
+
+hpx::task<int> add(int i, int j)
+{
+    int a = co_await value(i);
+    int b = co_await value(j);
+    co_return a + b;
+}
+
+// a deep chain of awaiting tasks does not grow the stack
+hpx::task<std::size_t> chain(std::size_t depth)
+{
+    if (depth == 0)
+        co_return 0;
+    co_return 1 + co_await chain(depth - 1);
+}
+
+hpx::task<std::unique_ptr<int>> move_only()
+{
+    co_return std::unique_ptr<int>(new int(42));
+}
+
+hpx::task<void> fail()
+{
+    throw std::runtime_error("fail");
+    co_return;
+}
+
+hpx::task<int> await_future()
+{
+    hpx::future<int> f = hpx::async([]() { return 21; });
+    int i = co_await std::move(f);
+
+    hpx::shared_future<int> sf = hpx::async([]() { return 21; });
+    co_return i + co_await sf;
+}
+
+hpx::task<void> lazy(bool& started)
+{
+    started = true;
+    co_return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    HPX_TEST_EQ(hpx::spawn(add(1, 2)).get(), 3);
+    HPX_TEST_EQ(hpx::spawn(chain(100000)).get(), std::size_t(100000));
+    HPX_TEST_EQ(*hpx::spawn(move_only()).get(), 42);
+    HPX_TEST_EQ(hpx::spawn(await_future()).get(), 42);
+
+    bool caught = false;
+    try
+    {
+        hpx::spawn(fail()).get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // tasks don't start running before they are awaited
+    bool started = false;
+    {
+        hpx::task<void> t = lazy(started);
+        HPX_TEST(t.valid());
+        HPX_TEST(!t.is_ready());
+    }
+    HPX_TEST(!started);
+
+    hpx::spawn(lazy(started)).get();
+    HPX_TEST(started);
+
+    return hpx::util::report_errors();
+}
+#endif
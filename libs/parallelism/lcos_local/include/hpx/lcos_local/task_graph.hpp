@@ -0,0 +1,339 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task_graph captures a directed acyclic graph of tasks once and
+    /// executes it as often as needed. Every node is a nullary function
+    /// which communicates with other nodes through data captured by
+    /// reference, the edges of the graph describe which nodes have to
+    /// complete before a node may run.
+    ///
+    /// Running the graph does not create any futures or continuations for
+    /// the individual nodes. All bookkeeping is precomputed when the graph
+    /// is instantiated, replaying it merely resets one counter per node and
+    /// schedules the nodes without predecessors. A node which completes
+    /// releases its successors, the last successor becoming ready is
+    /// executed directly on the same HPX thread.
+    ///
+    /// \note The graph may not be modified or destroyed while it is running.
+    class task_graph
+    {
+    public:
+        typedef std::size_t node_type;
+        typedef util::unique_function_nonser<void()> function_type;
+
+        /// Create an empty graph, its nodes are scheduled on the given
+        /// executor.
+        explicit task_graph(hpx::execution::parallel_executor exec =
+                                hpx::execution::parallel_executor())
+          : exec_(exec)
+          , dirty_(false)
+          , running_(false)
+          , remaining_(0)
+          , failed_(false)
+        {
+        }
+
+        task_graph(task_graph const&) = delete;
+        task_graph& operator=(task_graph const&) = delete;
+
+        ~task_graph()
+        {
+            HPX_ASSERT(!running_.load(std::memory_order_relaxed));
+        }
+
+        /// Add a node without any predecessors to the graph.
+        ///
+        /// \returns the handle of the new node
+        template <typename F>
+        node_type async(F&& f)
+        {
+            return add_node(std::forward<F>(f), nullptr, nullptr);
+        }
+
+        /// Add a node to the graph which runs once all of the given
+        /// nodes have completed.
+        ///
+        /// \returns the handle of the new node
+        template <typename F>
+        node_type dataflow(F&& f, std::vector<node_type> const& predecessors)
+        {
+            return add_node(std::forward<F>(f), predecessors.data(),
+                predecessors.data() + predecessors.size());
+        }
+
+        template <typename F>
+        node_type dataflow(
+            F&& f, std::initializer_list<node_type> predecessors)
+        {
+            return add_node(
+                std::forward<F>(f), predecessors.begin(), predecessors.end());
+        }
+
+        /// \returns the number of nodes in the graph
+        std::size_t size() const noexcept
+        {
+            return nodes_.size();
+        }
+
+        /// Remove all nodes from the graph.
+        void clear()
+        {
+            check_not_running("task_graph::clear");
+
+            nodes_.clear();
+            edges_.clear();
+            dirty_ = true;
+        }
+
+        /// Compute the successor lists of all nodes. This is done implicitly
+        /// by the first run after the graph was modified.
+        void instantiate()
+        {
+            check_not_running("task_graph::instantiate");
+
+            std::size_t const count = nodes_.size();
+
+            // successor lists in compressed row format
+            successor_offsets_.assign(count + 1, 0);
+            for (auto const& edge : edges_)
+                ++successor_offsets_[edge.first + 1];
+            for (std::size_t i = 0; i != count; ++i)
+                successor_offsets_[i + 1] += successor_offsets_[i];
+
+            successors_.resize(edges_.size());
+            std::vector<std::size_t> fill(
+                successor_offsets_.begin(), successor_offsets_.end() - 1);
+            for (auto const& edge : edges_)
+                successors_[fill[edge.first]++] = edge.second;
+
+            roots_.clear();
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (nodes_[i].predecessors == 0)
+                    roots_.push_back(i);
+            }
+
+            pending_.reset(
+                count != 0 ? new std::atomic<std::size_t>[count] : nullptr);
+
+            dirty_ = false;
+        }
+
+        /// Execute all nodes of the graph.
+        ///
+        /// \returns a future which becomes ready once all nodes have
+        ///          completed. If any of the nodes threw an exception, the
+        ///          future holds the first one, the nodes which had not
+        ///          started at that point are skipped.
+        future<void> run()
+        {
+            check_not_running("task_graph::run");
+
+            if (dirty_)
+                instantiate();
+
+            std::size_t const count = nodes_.size();
+            if (count == 0)
+                return make_ready_future();
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                pending_[i].store(
+                    nodes_[i].predecessors, std::memory_order_relaxed);
+            }
+
+            exception_ = std::exception_ptr();
+            failed_.store(false, std::memory_order_relaxed);
+
+            promise_ = promise<void>();
+            future<void> f = promise_.get_future();
+
+            // hold one additional reference while the roots are spawned,
+            // the graph may be destroyed as soon as the last node completed
+            running_.store(true, std::memory_order_relaxed);
+            remaining_.store(count + 1, std::memory_order_release);
+
+            for (std::size_t root : roots_)
+                spawn(root);
+
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                finish();
+
+            return f;
+        }
+
+    private:
+        struct node_data
+        {
+            explicit node_data(function_type&& f)
+              : f(std::move(f))
+              , predecessors(0)
+            {
+            }
+
+            function_type f;
+            std::size_t predecessors;
+        };
+
+        void check_not_running(char const* name) const
+        {
+            if (running_.load(std::memory_order_acquire))
+            {
+                HPX_THROW_EXCEPTION(invalid_status, name,
+                    "the task graph may not be modified or executed while "
+                    "it is running");
+            }
+        }
+
+        template <typename F>
+        node_type add_node(
+            F&& f, node_type const* first, node_type const* last)
+        {
+            check_not_running("task_graph::add_node");
+
+            node_type const node = nodes_.size();
+            for (node_type const* it = first; it != last; ++it)
+            {
+                // predecessors have to exist already, this guarantees that
+                // the graph does not contain any cycles
+                if (*it >= node)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "task_graph::add_node",
+                        "a predecessor of a node does not exist");
+                }
+            }
+
+            nodes_.emplace_back(function_type(std::forward<F>(f)));
+            for (node_type const* it = first; it != last; ++it)
+                edges_.emplace_back(*it, node);
+            nodes_.back().predecessors = std::size_t(last - first);
+
+            dirty_ = true;
+            return node;
+        }
+
+        void spawn(std::size_t node)
+        {
+            parallel::execution::post(
+                exec_, [this, node]() { execute(node); });
+        }
+
+        void execute(std::size_t node)
+        {
+            while (true)
+            {
+                if (!failed_.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        nodes_[node].f();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        if (!failed_.load(std::memory_order_relaxed))
+                        {
+                            exception_ = std::current_exception();
+                            failed_.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                // release all successors, keep the last one which became
+                // ready for this thread
+                std::size_t next = std::size_t(-1);
+                for (std::size_t i = successor_offsets_[node];
+                     i != successor_offsets_[node + 1]; ++i)
+                {
+                    std::size_t const successor = successors_[i];
+                    if (pending_[successor].fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next != std::size_t(-1))
+                            spawn(next);
+                        next = successor;
+                    }
+                }
+
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    HPX_ASSERT(next == std::size_t(-1));
+                    finish();
+                    return;
+                }
+
+                if (next == std::size_t(-1))
+                    return;
+
+                node = next;
+            }
+        }
+
+        // the graph may be destroyed as soon as the promise is set
+        void finish()
+        {
+            promise<void> p = std::move(promise_);
+            std::exception_ptr e = std::move(exception_);
+
+            running_.store(false, std::memory_order_release);
+
+            if (e)
+                p.set_exception(std::move(e));
+            else
+                p.set_value();
+        }
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        hpx::execution::parallel_executor exec_;
+
+        std::vector<node_data> nodes_;
+        std::vector<std::pair<std::size_t, std::size_t>> edges_;
+        bool dirty_;
+
+        // precomputed by instantiate()
+        std::vector<std::size_t> successor_offsets_;
+        std::vector<std::size_t> successors_;
+        std::vector<std::size_t> roots_;
+        std::unique_ptr<std::atomic<std::size_t>[]> pending_;
+
+        // state of the current run
+        std::atomic<bool> running_;
+        std::atomic<std::size_t> remaining_;
+        std::atomic<bool> failed_;
+        mutex_type mtx_;
+        std::exception_ptr exception_;
+        promise<void> promise_;
+    };
+}}}    // namespace hpx::lcos::local
@@ -0,0 +1,196 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using hpx::lcos::local::task_graph;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty_graph()
+{
+    task_graph g;
+    HPX_TEST_EQ(g.size(), std::size_t(0));
+
+    hpx::future<void> f = g.run();
+    HPX_TEST(f.is_ready());
+    f.get();
+}
+
+void test_diamond()
+{
+    // a -> b -> d and a -> c -> d
+    std::atomic<int> order(0);
+    int a = 0, b = 0, c = 0, d = 0;
+
+    task_graph g;
+    auto na = g.async([&]() { a = ++order; });
+    auto nb = g.dataflow([&]() { b = ++order; }, {na});
+    auto nc = g.dataflow([&]() { c = ++order; }, {na});
+    g.dataflow([&]() { d = ++order; }, {nb, nc});
+
+    HPX_TEST_EQ(g.size(), std::size_t(4));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        order = 0;
+        g.run().get();
+
+        HPX_TEST_EQ(a, 1);
+        HPX_TEST(b > a && c > a);
+        HPX_TEST(d > b && d > c);
+        HPX_TEST_EQ(d, 4);
+    }
+}
+
+void test_chains()
+{
+    constexpr std::size_t num_chains = 16;
+    constexpr std::size_t length = 100;
+
+    std::vector<std::size_t> values(num_chains, 0);
+
+    task_graph g;
+    for (std::size_t i = 0; i != num_chains; ++i)
+    {
+        std::size_t* value = &values[i];
+        auto n = g.async([value]() { *value = 0; });
+        for (std::size_t j = 0; j != length; ++j)
+        {
+            n = g.dataflow(
+                [value, j]() {
+                    HPX_TEST_EQ(*value, j);
+                    ++*value;
+                },
+                {n});
+        }
+    }
+
+    for (int i = 0; i != 10; ++i)
+    {
+        g.run().get();
+        for (std::size_t value : values)
+        {
+            HPX_TEST_EQ(value, length);
+        }
+    }
+}
+
+void test_fan_in()
+{
+    constexpr std::size_t width = 1000;
+
+    std::atomic<std::size_t> count(0);
+    std::size_t result = 0;
+
+    task_graph g;
+    std::vector<task_graph::node_type> nodes;
+    for (std::size_t i = 0; i != width; ++i)
+        nodes.push_back(g.async([&]() { ++count; }));
+    g.dataflow([&]() { result = count.load(); }, nodes);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        count = 0;
+        result = 0;
+        g.run().get();
+        HPX_TEST_EQ(result, width);
+    }
+}
+
+void test_exception()
+{
+    std::atomic<int> executed(0);
+    bool fail = true;
+
+    task_graph g;
+    auto n = g.async([&]() {
+        ++executed;
+        if (fail)
+            throw std::runtime_error("test");
+    });
+    g.dataflow([&]() { ++executed; }, {n});
+
+    bool caught = false;
+    try
+    {
+        g.run().get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    // the successor of the failing node is skipped
+    HPX_TEST_EQ(executed.load(), 1);
+
+    // the graph can be replayed after a failure
+    fail = false;
+    executed = 0;
+    g.run().get();
+    HPX_TEST_EQ(executed.load(), 2);
+}
+
+void test_invalid_predecessor()
+{
+    task_graph g;
+    auto n = g.async([]() {});
+
+    bool caught = false;
+    try
+    {
+        g.dataflow([]() {}, {n + 1});
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught);
+    HPX_TEST_EQ(g.size(), std::size_t(1));
+}
+
+void test_modify()
+{
+    int value = 0;
+
+    task_graph g;
+    auto n = g.async([&]() { value = 1; });
+    g.run().get();
+    HPX_TEST_EQ(value, 1);
+
+    // adding nodes after a run instantiates the graph again
+    g.dataflow([&]() { value *= 2; }, {n});
+    g.run().get();
+    HPX_TEST_EQ(value, 2);
+
+    g.clear();
+    HPX_TEST_EQ(g.size(), std::size_t(0));
+    value = 0;
+    g.run().get();
+    HPX_TEST_EQ(value, 0);
+}
+
+int main()
+{
+    test_empty_graph();
+    test_diamond();
+    test_chains();
+    test_fan_in();
+    test_exception();
+    test_invalid_predecessor();
+    test_modify();
+
+    return hpx::util::report_errors();
+}
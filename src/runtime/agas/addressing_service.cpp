@@ -20,10 +20,13 @@
 #include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/apply.hpp>
 #include <hpx/components_base/traits/component_supports_migration.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
 #include <hpx/execution_base/register_locks.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/async_distributed.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution.hpp>
@@ -54,11 +57,16 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading/thread.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/traits/action_was_object_migrated.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -139,6 +147,21 @@ namespace hpx { namespace agas
         }
     }; // }}}
 
+    // Incref requests are staged in a lock-free queue (using implicit
+    // per-producer sub-queues, i.e. each worker thread effectively stages into
+    // its own buffer) until they are flushed to AGAS.
+    struct addressing_service::incref_requests_type
+    {    // {{{ incref_requests_type implementation
+        struct request
+        {
+            naming::gid_type gid_;
+            std::int64_t credits_;
+            lcos::local::promise<std::int64_t> promise_;
+        };
+
+        hpx::concurrency::ConcurrentQueue<request> queue_;
+    }; // }}}
+
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
@@ -149,6 +172,15 @@ addressing_service::addressing_service(
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
   , refcnt_requests_(new refcnt_requests_type)
+  , max_incref_requests_(ini_.get_agas_max_pending_incref_requests())
+  , incref_flush_delay_(ini_.get_agas_incref_flush_delay())
+  , incref_requests_(std::make_shared<incref_requests_type>())
+  , incref_requests_count_(0)
+  , enable_incref_staging_(max_incref_requests_ != 0)
+  , incref_staging_operations_(0)
+  , refcnt_batches_sent_(0)
+  , refcnt_credits_coalesced_(0)
+  , resolve_time_histogram_(ini_.get_os_thread_count() + 1)
   , service_type(ini_.get_agas_service_mode())
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
@@ -1135,7 +1167,9 @@ bool addressing_service::resolve_full_local(
     )
 { // {{{ resolve implementation
     try {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
         auto rep = primary_ns_.resolve_gid(id);
+        record_resolve_time(start);
 
         using hpx::get;
 
@@ -1377,15 +1411,16 @@ hpx::future<naming::address> addressing_service::resolve_full_async(
     }
 
     // ask server
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
     future<primary_namespace::resolved_type> f =
         primary_ns_.resolve_full(gid);
 
-    return f.then(
-        hpx::launch::sync,
-        util::one_shot(util::bind_front(
-            &addressing_service::resolve_full_postproc,
-            this,  gid
-        )));
+    return f.then(hpx::launch::sync,
+        [this, gid, start](future<primary_namespace::resolved_type>&& f)
+        {
+            record_resolve_time(start);
+            return resolve_full_postproc(gid, std::move(f));
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1415,7 +1450,10 @@ bool addressing_service::resolve_full_local(
 
             if (!addrs[i] && !locals.test(i))
             {
+                std::uint64_t const start =
+                    hpx::chrono::high_resolution_clock::now();
                 auto rep = primary_ns_.resolve_gid(gids[i]);
+                record_resolve_time(start);
 
                 if (get<0>(rep) == naming::invalid_gid ||
                     get<2>(rep) == naming::invalid_gid)
@@ -1588,11 +1626,18 @@ lcos::future<std::int64_t> addressing_service::incref_async(
 
     std::pair<naming::gid_type, std::int64_t> pending_incref;
     bool has_pending_incref = false;
+    bool stage_incref = false;
     std::int64_t pending_decrefs = 0;
 
     {
         std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
 
+        // keep track of this thread possibly staging a request, shutdown
+        // will wait for it to finish
+        stage_incref = enable_refcnt_caching_ && enable_incref_staging_;
+        if (stage_incref)
+            ++incref_staging_operations_;
+
         typedef refcnt_requests_type::iterator iterator;
 
         iterator matches = refcnt_requests_->find(raw);
@@ -1636,14 +1681,36 @@ lcos::future<std::int64_t> addressing_service::incref_async(
 
     if (!has_pending_incref)
     {
+        if (stage_incref)
+            --incref_staging_operations_;
+
         // no need to talk to AGAS, acknowledge the incref immediately
+        refcnt_credits_coalesced_ += credit;
         return hpx::make_ready_future(pending_decrefs);
     }
 
+    refcnt_credits_coalesced_ += credit - pending_incref.second;
+
     naming::gid_type const e_lower = pending_incref.first;
 
-    lcos::future<std::int64_t> f =
-        primary_ns_.increment_credit(pending_incref.second, e_lower, e_lower);
+    // Requests handled by the local AGAS instance are not staged, those don't
+    // cause any network traffic.
+    lcos::future<std::int64_t> f;
+    if (stage_incref &&
+        naming::get_locality_from_gid(
+            primary_namespace::get_service_instance(e_lower)) !=
+            get_local_locality())
+    {
+        f = stage_incref_request(e_lower, pending_incref.second);
+    }
+    else
+    {
+        f = primary_ns_.increment_credit(
+            pending_incref.second, e_lower, e_lower);
+    }
+
+    if (stage_incref)
+        --incref_staging_operations_;
 
     // pass the amount of compensated decrefs to the callback
     using util::placeholders::_1;
@@ -1699,6 +1766,7 @@ void addressing_service::decref(
         if (matches != refcnt_requests_->end())
         {
             matches->second -= credit;
+            refcnt_credits_coalesced_ += credit;
         }
         else
         {
@@ -1724,6 +1792,152 @@ void addressing_service::decref(
     }
 } // }}}
 
+///////////////////////////////////////////////////////////////////////////////
+lcos::future<std::int64_t> addressing_service::stage_incref_request(
+    naming::gid_type const& gid
+  , std::int64_t credits
+    )
+{
+    lcos::local::promise<std::int64_t> p;
+    lcos::future<std::int64_t> f = p.get_future();
+
+    incref_requests_->queue_.enqueue(
+        incref_requests_type::request{gid, credits, std::move(p)});
+
+    // The thread staging the first request is responsible for making sure the
+    // staged requests will eventually be flushed. Flush right away if enough
+    // requests have accumulated.
+    std::int64_t const count = ++incref_requests_count_;
+    if (count >= static_cast<std::int64_t>(max_incref_requests_))
+    {
+        send_incref_requests();
+    }
+    else if (count == 1)
+    {
+        schedule_incref_requests_flush();
+    }
+
+    return f;
+}
+
+void addressing_service::schedule_incref_requests_flush()
+{
+    // the flush task is accounted for until it has finished running,
+    // start_shutdown waits for it
+    ++incref_staging_operations_;
+
+    std::int64_t const delay = incref_flush_delay_;
+    hpx::apply([this, delay]() -> void {
+        if (delay > 0)
+        {
+            hpx::this_thread::sleep_for(std::chrono::microseconds(delay));
+        }
+        send_incref_requests();
+        --incref_staging_operations_;
+    });
+}
+
+std::vector<hpx::future<void> > addressing_service::send_incref_requests()
+{
+    using request = incref_requests_type::request;
+
+    std::vector<request> staged;
+    staged.reserve(max_incref_requests_);
+
+    request req;
+    while (incref_requests_->queue_.try_dequeue(req))
+    {
+        staged.push_back(std::move(req));
+    }
+
+    std::vector<hpx::future<void> > results;
+    if (staged.empty())
+        return results;
+
+    // Requests which were counted but not dequeued by us have been staged
+    // concurrently, make sure those will be sent as well.
+    if ((incref_requests_count_ -=
+            static_cast<std::int64_t>(staged.size())) > 0)
+    {
+        schedule_incref_requests_flush();
+    }
+
+    LAGAS_(info) << hpx::util::format(
+        "addressing_service::send_incref_requests, requests({1})",
+        staged.size());
+
+    // coalesce all requests for the same gid
+    std::map<naming::gid_type, std::int64_t> credits;
+    for (request const& r : staged)
+    {
+        std::int64_t& c = credits[r.gid_];
+        if (c != 0)
+            refcnt_credits_coalesced_ += r.credits_;
+        c += r.credits_;
+    }
+
+    // collect all requests for each locality
+    struct destination_requests
+    {
+        std::vector<
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+        > requests_;
+        std::vector<lcos::local::promise<std::int64_t> > promises_;
+    };
+
+    std::map<naming::id_type, destination_requests> requests;
+    for (auto const& e : credits)
+    {
+        naming::id_type target(
+            primary_namespace::get_service_instance(e.first)
+          , naming::id_type::unmanaged);
+
+        requests[target].requests_.push_back(
+            hpx::make_tuple(e.second, e.first, e.first));
+    }
+
+    for (request& r : staged)
+    {
+        naming::id_type target(
+            primary_namespace::get_service_instance(r.gid_)
+          , naming::id_type::unmanaged);
+
+        requests[target].promises_.push_back(std::move(r.promise_));
+    }
+
+    // send one request to each locality, acknowledge all increfs for that
+    // locality once it has been handled
+    results.reserve(requests.size());
+    for (auto& e : requests)
+    {
+        ++refcnt_batches_sent_;
+
+        server::primary_namespace::increment_credits_action action;
+        hpx::future<void> f = hpx::async(
+            action, e.first, std::move(e.second.requests_));
+
+        results.push_back(f.then(hpx::launch::sync,
+            [promises = std::move(e.second.promises_)](
+                hpx::future<void>&& f) mutable -> void
+            {
+                if (f.has_exception())
+                {
+                    std::exception_ptr ex = f.get_exception_ptr();
+                    for (auto& p : promises)
+                        p.set_exception(ex);
+                    f.get();    // rethrow for synchronous flushes
+                }
+                else
+                {
+                    for (auto& p : promises)
+                        p.set_value(0);
+                }
+            }));
+    }
+
+    return results;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 static bool correct_credit_on_failure(future<bool> f, naming::id_type id,
     std::int64_t mutable_gid_credit, std::int64_t new_gid_credit)
@@ -2109,6 +2323,25 @@ void addressing_service::remove_cache_entry(
 // Disable refcnt caching during shutdown
 void addressing_service::start_shutdown(error_code& ec)
 {
+    // Stop staging increfs, wait for all threads still staging or flushing
+    // them and synchronously send whatever is left.
+    {
+        std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+        enable_incref_staging_ = false;
+    }
+
+    util::yield_while(
+        [this]() { return incref_staging_operations_.load() != 0; },
+        "addressing_service::start_shutdown");
+
+    try {
+        when_all(send_incref_requests()).get();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::start_shutdown");
+        return;
+    }
+
     // If caching is disabled, we silently pretend success.
     if (!caching_)
         return;
@@ -2269,6 +2502,38 @@ std::uint64_t addressing_service::get_cache_insertions(bool reset)
     return gva_cache_->get_statistics().insertions(reset);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void addressing_service::record_resolve_time(std::uint64_t start)
+{
+    // worker threads record into their own slot, all other threads share the
+    // last one
+    std::size_t const last_slot = resolve_time_histogram_.num_slots() - 1;
+    std::size_t slot = hpx::get_worker_thread_num();
+    if (slot > last_slot)
+        slot = last_slot;
+
+    resolve_time_histogram_.record(
+        hpx::chrono::high_resolution_clock::now() - start, slot);
+}
+
+std::int64_t addressing_service::get_resolve_time_percentile(
+    double percentile, bool reset)
+{
+    return std::int64_t(
+        resolve_time_histogram_.get_percentile(percentile, reset));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t addressing_service::get_refcnt_batches_sent(bool reset)
+{
+    return util::get_and_reset_value(refcnt_batches_sent_, reset);
+}
+
+std::uint64_t addressing_service::get_refcnt_credits_coalesced(bool reset)
+{
+    return util::get_and_reset_value(refcnt_credits_coalesced_, reset);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
@@ -2359,6 +2624,16 @@ void addressing_service::register_counter_types()
         util::bind_front(
             &addressing_service::get_cache_erase_entry_time, this));
 
+    util::function_nonser<std::int64_t(bool)> refcnt_batches_sent(
+        util::bind_front(
+            &addressing_service::get_refcnt_batches_sent, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_credits_coalesced(
+        util::bind_front(
+            &addressing_service::get_refcnt_credits_coalesced, this));
+    util::function_nonser<std::int64_t(double, bool)> resolve_time_percentile(
+        util::bind_front(
+            &addressing_service::get_resolve_time_percentile, this));
+
     using util::placeholders::_1;
     using util::placeholders::_2;
     performance_counters::generic_counter_type_data const counter_types[] =
@@ -2447,6 +2722,17 @@ void addressing_service::register_counter_types()
           &performance_counters::locality_counter_discoverer,
           ""
         },
+        { "/agas/time/resolve-percentile",
+            performance_counters::counter_raw,
+          "returns the time needed to resolve a global address through AGAS "
+                "(not using the AGAS cache) at the percentile given as the "
+                "counter parameter (default: 50)",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_percentile_counter_creator,
+              _1, resolve_time_percentile, _2),
+          &performance_counters::locality_counter_discoverer,
+          "ns"
+        },
         { "/agas/time/cache/get_entry",
             performance_counters::counter_monotonically_increasing,
           "returns the overall time spent executing of the get_entry API "
@@ -2487,6 +2773,27 @@ void addressing_service::register_counter_types()
           &performance_counters::locality_counter_discoverer,
           ""
         },
+        { "/agas/count/refcnt/batches",
+            performance_counters::counter_monotonically_increasing,
+          "returns the number of aggregated reference counting requests "
+                "(increments and decrements) sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_batches_sent, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt/coalesced_credits",
+            performance_counters::counter_monotonically_increasing,
+          "returns the number of credits which did not require a separate "
+                "reference counting request as they were combined with other "
+                "pending requests",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_credits_coalesced, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
     };
     performance_counters::install_counter_types(
         counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -2510,6 +2817,8 @@ void addressing_service::garbage_collect_non_blocking(
     error_code& ec
     )
 {
+    send_incref_requests();
+
     std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
     if (!l.owns_lock()) return;     // no need to compete for garbage collection
 
@@ -2520,6 +2829,8 @@ void addressing_service::garbage_collect(
     error_code& ec
     )
 {
+    send_incref_requests();
+
     std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
     if (!l.owns_lock()) return;     // no need to compete for garbage collection
 
@@ -2637,6 +2948,8 @@ void addressing_service::send_refcnt_requests_non_blocking(
         requests_type::iterator end = requests.end();
         for (requests_type::iterator it = requests.begin(); it != end; ++it)
         {
+            ++refcnt_batches_sent_;
+
             server::primary_namespace::decrement_credit_action action;
             hpx::apply(action, std::move(it->first), std::move(it->second));
         }
@@ -2711,6 +3024,8 @@ addressing_service::send_refcnt_requests_async(
     requests_type::const_iterator end = requests.end();
     for (requests_type::const_iterator it = requests.begin(); it != end; ++it)
     {
+        ++refcnt_batches_sent_;
+
         server::primary_namespace::decrement_credit_action action;
         lazy_results.push_back(
             hpx::async(action, std::move(it->first), std::move(it->second)));
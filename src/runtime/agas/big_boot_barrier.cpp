@@ -88,7 +88,20 @@ namespace hpx { namespace agas { namespace detail
                 instance().get_unassigned_typenames())
           , action_typenames(hpx::actions::detail::action_registry::
                 instance().get_unassigned_typenames())
-        {}
+          , assigned_action_typenames(hpx::actions::detail::action_registry::
+                instance().get_assigned_typenames())
+        {
+            // the ids which were assigned locally have to be verified by
+            // locality 0
+            hpx::actions::detail::action_registry& registry =
+                hpx::actions::detail::action_registry::instance();
+
+            assigned_action_ids.reserve(assigned_action_typenames.size());
+            for (std::string const& s : assigned_action_typenames)
+            {
+                assigned_action_ids.push_back(registry.try_get_id(s));
+            }
+        }
 
         void save(hpx::serialization::output_archive& ar, unsigned) const
         {
@@ -96,6 +109,8 @@ namespace hpx { namespace agas { namespace detail
             HPX_ASSERT(!action_typenames.empty());
             ar << serialization_typenames;
             ar << action_typenames;
+            ar << assigned_action_typenames;
+            ar << assigned_action_ids;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
@@ -103,11 +118,15 @@ namespace hpx { namespace agas { namespace detail
             // part running on locality 0
             ar >> serialization_typenames;
             ar >> action_typenames;
+            ar >> assigned_action_typenames;
+            ar >> assigned_action_ids;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
         std::vector<std::string> serialization_typenames;
         std::vector<std::string> action_typenames;
+        std::vector<std::string> assigned_action_typenames;
+        std::vector<std::uint32_t> assigned_action_ids;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -126,12 +145,14 @@ namespace hpx { namespace agas { namespace detail
             HPX_ASSERT(!action_ids.empty());
             ar << serialization_ids;      // part running on locality 0
             ar << action_ids;
+            ar << inconsistent_action_typenames;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
         {
             ar >> serialization_ids;      // part running on worker node
             ar >> action_ids;
+            ar >> inconsistent_action_typenames;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
@@ -172,6 +193,13 @@ namespace hpx { namespace agas { namespace detail
                     }
                     action_ids.push_back(id);
                 }
+
+                // all parcels are dispatched by directly indexing the action
+                // table, thus the ids assigned on the worker have to match
+                inconsistent_action_typenames =
+                    registry.get_inconsistent_typenames(
+                        unassigned_ids.assigned_action_typenames,
+                        unassigned_ids.assigned_action_ids);
             }
         }
 
@@ -200,6 +228,18 @@ namespace hpx { namespace agas { namespace detail
                 // order problems
                 registry.fill_missing_typenames();
             }
+            if (!inconsistent_action_typenames.empty())
+            {
+                std::string msg(
+                    "the ids of the following actions do not match the ids "
+                    "used by locality 0:");
+                for (std::string const& s : inconsistent_action_typenames)
+                {
+                    msg += "\n    " + s;
+                }
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "assigned_id_sequence::register_ids_on_worker_loc", msg);
+            }
             {
                 hpx::actions::detail::action_registry& registry =
                     hpx::actions::detail::action_registry::instance();
@@ -226,6 +266,7 @@ namespace hpx { namespace agas { namespace detail
 
         std::vector<std::uint32_t> serialization_ids;
         std::vector<std::uint32_t> action_ids;
+        std::vector<std::string> inconsistent_action_typenames;
     };
 }}} // namespace hpx::agas::detail
 
@@ -8,6 +8,7 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/assert.hpp>
+#include <hpx/logging/format/async_write.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/runtime_local/runtime_local.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
@@ -269,6 +270,8 @@ namespace hpx { namespace components
 
     void cleanup_logging()
     {
+        // write everything still queued by the background writer first
+        util::logging::flush_async_writing();
         detail::logger().cleanup();
     }
 
@@ -0,0 +1,177 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/naming_base/naming_base.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_destination_table.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    parcel_queue::parcel_queue(locality const& dest)
+      : dest_(dest)
+      , next_(nullptr)
+    {
+    }
+
+    void parcel_queue::enqueue(parcel&& p, write_handler_type&& f)
+    {
+        queue_.enqueue(entry(std::move(p), std::move(f)));
+    }
+
+    void parcel_queue::enqueue(std::vector<parcel>&& parcels,
+        std::vector<write_handler_type>&& handlers)
+    {
+        HPX_ASSERT(parcels.size() == handlers.size());
+
+        std::vector<entry> entries;
+        entries.reserve(parcels.size());
+        for (std::size_t i = 0; i != parcels.size(); ++i)
+        {
+            entries.emplace_back(
+                std::move(parcels[i]), std::move(handlers[i]));
+        }
+
+        queue_.enqueue_bulk(
+            std::make_move_iterator(entries.begin()), entries.size());
+    }
+
+    bool parcel_queue::dequeue(std::vector<parcel>& parcels,
+        std::vector<write_handler_type>& handlers, std::size_t max_parcels)
+    {
+        HPX_ASSERT(parcels.empty() && handlers.empty());
+
+        // drain everything which is available now as one batch
+        std::size_t count = (std::min)(queue_.size_approx(), max_parcels);
+        if (count == 0)
+            return false;
+
+        std::vector<entry> entries(count);
+        count = queue_.try_dequeue_bulk(entries.begin(), count);
+        if (count == 0)
+            return false;
+
+        parcels.reserve(count);
+        handlers.reserve(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            parcels.push_back(std::move(entries[i].parcel_));
+            handlers.push_back(std::move(entries[i].handler_));
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    parcel_destination_table::index::index(std::size_t size)
+      : size_(size)
+      , slots_(new std::atomic<parcel_queue*>[size])
+    {
+        for (std::size_t i = 0; i != size_; ++i)
+            slots_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    parcel_destination_table::parcel_destination_table()
+      : index_(nullptr)
+      , queues_(nullptr)
+    {
+        indices_.emplace_back(new index(64));
+        index_.store(indices_.back().get(), std::memory_order_release);
+    }
+
+    parcel_destination_table::~parcel_destination_table() = default;
+
+    parcel_queue& parcel_destination_table::get(
+        locality const& dest, std::uint32_t locality_id)
+    {
+        index const* idx = index_.load(std::memory_order_acquire);
+        if (locality_id < idx->size_)
+        {
+            parcel_queue* q =
+                idx->slots_[locality_id].load(std::memory_order_acquire);
+            if (q != nullptr)
+            {
+                HPX_ASSERT(q->destination() == dest);
+                return *q;
+            }
+        }
+        return get_slow(dest, locality_id);
+    }
+
+    parcel_queue& parcel_destination_table::get_slow(
+        locality const& dest, std::uint32_t locality_id)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // every destination has exactly one queue, regardless of whether it
+        // is looked up with or without its locality id
+        std::unique_ptr<parcel_queue>& queue = by_locality_[dest];
+        if (!queue)
+        {
+            queue.reset(new parcel_queue(dest));
+
+            queue->next_ = queues_.load(std::memory_order_relaxed);
+            queues_.store(queue.get(), std::memory_order_release);
+        }
+
+        if (locality_id == naming::invalid_locality_id)
+            return *queue;
+
+        // grow the index geometrically, older arrays stay valid for
+        // concurrent readers
+        index* idx = index_.load(std::memory_order_relaxed);
+        if (locality_id >= idx->size_)
+        {
+            std::size_t size = idx->size_;
+            while (size <= locality_id)
+                size *= 2;
+
+            std::unique_ptr<index> new_idx(new index(size));
+            for (std::size_t i = 0; i != idx->size_; ++i)
+            {
+                new_idx->slots_[i].store(
+                    idx->slots_[i].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+
+            idx = new_idx.get();
+            indices_.push_back(std::move(new_idx));
+            index_.store(idx, std::memory_order_release);
+        }
+
+        idx->slots_[locality_id].store(
+            queue.get(), std::memory_order_release);
+
+        return *queue;
+    }
+
+    std::int64_t parcel_destination_table::get_pending_parcels_count() const
+    {
+        std::int64_t count = 0;
+        for (parcel_queue* q = queues_.load(std::memory_order_acquire);
+             q != nullptr; q = q->next_)
+        {
+            count += static_cast<std::int64_t>(q->size());
+        }
+        return count;
+    }
+}}}
+
+#endif
+#endif
@@ -981,6 +981,24 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_receiving_time(reset) : 0;
     }
 
+    // the time it took for a send (receive) at the given percentile
+    // (nanoseconds)
+    std::int64_t parcelhandler::get_sending_time_percentile(
+        std::string const& pp_type, double percentile, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_sending_time_percentile(percentile, reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_receiving_time_percentile(
+        std::string const& pp_type, double percentile, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receiving_time_percentile(percentile, reset) : 0;
+    }
+
     // the total time it took for all sender-side serialization operations
     // (nanoseconds)
     std::int64_t parcelhandler::get_sending_serialization_time(
@@ -1221,6 +1239,13 @@ namespace hpx { namespace parcelset
         util::function_nonser<std::int64_t(bool)> receiving_time(
             util::bind_front(&parcelhandler::get_receiving_time, this,
                 pp_type));
+        util::function_nonser<std::int64_t(double, bool)>
+            sending_time_percentile(util::bind_front(
+                &parcelhandler::get_sending_time_percentile, this, pp_type));
+        util::function_nonser<std::int64_t(double, bool)>
+            receiving_time_percentile(util::bind_front(
+                &parcelhandler::get_receiving_time_percentile, this,
+                pp_type));
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         util::function_nonser<std::int64_t(std::string const&, bool)>
@@ -1363,6 +1388,36 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format("/data/time/{}/sent-percentile", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the time between the start of an asynchronous "
+                  "write and the invocation of the write callback at the "
+                  "percentile given as the counter parameter (default: 50) "
+                  "using the {} connection type for the referenced locality",
+                      pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(
+                  &performance_counters::locality_percentile_counter_creator,
+                  _1, std::move(sending_time_percentile), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { hpx::util::format("/data/time/{}/received-percentile", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the time between the start of an asynchronous "
+                  "read and the invocation of the read callback at the "
+                  "percentile given as the counter parameter (default: 50) "
+                  "using the {} connection type for the referenced locality",
+                      pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(
+                  &performance_counters::locality_percentile_counter_creator,
+                  _1, std::move(receiving_time_percentile), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
             { hpx::util::format("/serialize/time/{}/sent", pp_type),
               performance_counters::counter_elapsed_time,
               hpx::util::format(
@@ -1686,6 +1741,8 @@ namespace hpx { namespace parcelset
             "$[hpx.parcel.array_optimization]}");
         ini_defs.push_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.push_back("adaptive_direct_actions = "
+                           "${HPX_PARCEL_ADAPTIVE_DIRECT_ACTIONS:0}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.push_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -21,6 +21,7 @@
 #include <hpx/modules/errors.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #endif
 #include <hpx/assert.hpp>
 
@@ -37,10 +38,11 @@ namespace hpx { namespace parcelset
     parcelport::parcelport(util::runtime_configuration const& ini,
             locality const & here, std::string const& type)
       : applier_(nullptr),
-        num_parcel_destinations_(0),
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
+        sending_time_histogram_(ini.get_os_thread_count() + 1),
+        receiving_time_histogram_(ini.get_os_thread_count() + 1),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
@@ -74,17 +76,35 @@ namespace hpx { namespace parcelset
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // worker threads record into their own slot, all other threads (e.g.
+        // io-service threads) share the last one
+        void record_time(util::log_linear_histogram& histogram,
+            std::int64_t time)
+        {
+            std::size_t const last_slot = histogram.num_slots() - 1;
+            std::size_t slot = hpx::get_worker_thread_num();
+            if (slot > last_slot)
+                slot = last_slot;
+
+            histogram.record(std::uint64_t(time > 0 ? time : 0), slot);
+        }
+    }    // namespace detail
+
     // Update performance counter data
     void parcelport::add_received_data(
         performance_counters::parcels::data_point const& data)
     {
         parcels_received_.add_data(data);
+        detail::record_time(receiving_time_histogram_, data.time_);
     }
 
     void parcelport::add_sent_data(
         performance_counters::parcels::data_point const& data)
     {
         parcels_sent_.add_data(data);
+        detail::record_time(sending_time_histogram_, data.time_);
     }
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -140,6 +160,24 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_time(reset);
     }
 
+    // the time it took for a send, from async_write to the completion
+    // handler, at the given percentile (nanoseconds)
+    std::int64_t parcelport::get_sending_time_percentile(
+        double percentile, bool reset)
+    {
+        return std::int64_t(
+            sending_time_histogram_.get_percentile(percentile, reset));
+    }
+
+    // the time it took for a receive, from async_read to the completion
+    // handler, at the given percentile (nanoseconds)
+    std::int64_t parcelport::get_receiving_time_percentile(
+        double percentile, bool reset)
+    {
+        return std::int64_t(
+            receiving_time_histogram_.get_percentile(percentile, reset));
+    }
+
     // the total time it took for all sender-side serialization operations
     // (nanoseconds)
     std::int64_t parcelport::get_sending_serialization_time(bool reset)
@@ -190,16 +228,7 @@ namespace hpx { namespace parcelset
 
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<lcos::local::spinlock> l(mtx_);
-        std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
-        {
-            count += hpx::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() ==
-                hpx::get<1>(p.second).size());
-        }
-        return count;
+        return parcel_destinations_.get_pending_parcels_count();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,411 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/runtime/threads/elasticity_controller.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads {
+    namespace {
+        // the worker threads of a pool are either running or were suspended
+        // individually, the pool as a whole is neither suspended nor stopping
+        bool is_pool_running(thread_pool_base const& pool)
+        {
+            std::pair<hpx::state, hpx::state> const s =
+                pool.get_scheduler()->get_minmax_state();
+            return s.first >= state_running && s.first != state_suspended &&
+                s.second <= state_sleeping;
+        }
+    }    // namespace
+
+    elasticity_controller::elasticity_controller(
+        std::vector<std::string> const& pools,
+        elasticity_parameters const& params)
+      : params_(params)
+      , num_lent_(0)
+      , num_suspended_(0)
+      , num_resumed_(0)
+      , stop_(true)
+    {
+        auto& rp = hpx::resource::get_partitioner();
+
+        pools_.reserve(pools.size());
+        for (std::string const& name : pools)
+        {
+            thread_pool_base& pool = hpx::resource::get_thread_pool(name);
+
+            std::size_t const p = pools_.size();
+            pools_.push_back(managed_pool{&pool, {}, 0, 0});
+
+            std::size_t const offset = pool.get_thread_offset();
+            std::size_t const num_threads = pool.get_os_thread_count();
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                pools_.back().workers_.push_back(workers_.size());
+                workers_.push_back(
+                    worker{p, i, rp.get_pu_num(offset + i), true});
+            }
+        }
+    }
+
+    elasticity_controller::~elasticity_controller()
+    {
+        error_code ec(lightweight);
+        stop(ec);
+    }
+
+    void elasticity_controller::start(error_code& ec)
+    {
+        if (is_running())
+        {
+            HPX_THROWS_IF(ec, invalid_status, "elasticity_controller::start",
+                "the elasticity controller is already running");
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+
+            for (managed_pool const& p : pools_)
+            {
+                if (!p.pool_->get_scheduler()->has_scheduler_mode(
+                        policies::enable_elasticity))
+                {
+                    HPX_THROWS_IF(ec, invalid_status,
+                        "elasticity_controller::start",
+                        hpx::util::format("the thread pool '{}' does not "
+                                          "support suspending processing "
+                                          "units",
+                            p.pool_->get_pool_name()));
+                    return;
+                }
+            }
+
+            // only one worker thread per processing unit is active, the pool
+            // listed first keeps its worker threads
+            for (std::size_t w = 0; w != workers_.size(); ++w)
+            {
+                if (!workers_[w].active_)
+                    continue;
+
+                for (std::size_t o = 0; o != w; ++o)
+                {
+                    if (workers_[o].active_ &&
+                        workers_[o].pu_ == workers_[w].pu_)
+                    {
+                        if (!suspend(w, ec))
+                            return;
+                        break;
+                    }
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> l(run_mtx_);
+            stop_ = false;
+        }
+        thread_ = std::thread(&elasticity_controller::run, this);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void elasticity_controller::stop(error_code& ec)
+    {
+        {
+            std::lock_guard<std::mutex> l(run_mtx_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+
+        if (thread_.joinable())
+            thread_.join();
+
+        std::lock_guard<std::mutex> l(mtx_);
+        for (std::size_t w = 0; w != workers_.size(); ++w)
+        {
+            if (!workers_[w].active_ && !resume(w, ec))
+                return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    bool elasticity_controller::is_running() const
+    {
+        return thread_.joinable();
+    }
+
+    void elasticity_controller::run()
+    {
+        std::unique_lock<std::mutex> l(run_mtx_);
+        while (!cond_.wait_for(l, params_.interval, [this] { return stop_; }))
+        {
+            l.unlock();
+
+            // errors are transient (e.g. the pool is being stopped), the
+            // pools are evaluated again on the next interval
+            error_code ec(lightweight);
+            evaluate(ec);
+
+            l.lock();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void elasticity_controller::evaluate(error_code& ec)
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+
+        std::vector<bool> busy(pools_.size(), false);
+        std::vector<double> idle_rates(pools_.size(), 0.0);
+
+        for (std::size_t p = 0; p != pools_.size(); ++p)
+        {
+            managed_pool& mp = pools_[p];
+            if (!is_pool_running(*mp.pool_))
+            {
+                mp.busy_count_ = mp.idle_count_ = 0;
+                continue;
+            }
+
+            std::size_t const active = num_active(mp);
+            std::int64_t const queue_length =
+                mp.pool_->get_queue_length(std::size_t(-1), false);
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            // the idle rate is given in 0.01%
+            double idle_rate = mp.pool_->avg_idle_rate_all(true) / 100.0;
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS)
+            // background work is counted as idle time, the overhead is given
+            // in 0.1%
+            double const background =
+                mp.pool_->get_background_overhead(std::size_t(-1), true) /
+                10.0;
+            if (background > 0.0 && background <= idle_rate)
+                idle_rate -= background;
+#endif
+#else
+            double idle_rate =
+                100.0 - double(mp.pool_->get_scheduler_utilization());
+#endif
+            idle_rates[p] = idle_rate;
+
+            busy[p] = double(queue_length) >
+                params_.busy_queue_length * double(active);
+
+            if (busy[p])
+            {
+                ++mp.busy_count_;
+                mp.idle_count_ = 0;
+            }
+            else if (queue_length == 0 && idle_rate >= params_.idle_rate)
+            {
+                ++mp.idle_count_;
+                mp.busy_count_ = 0;
+            }
+            else
+            {
+                mp.busy_count_ = mp.idle_count_ = 0;
+            }
+        }
+
+        // first give back processing units of idle pools, this makes them
+        // available to the busy pools below
+        for (std::size_t p = 0; p != pools_.size(); ++p)
+        {
+            managed_pool& mp = pools_[p];
+            if (mp.idle_count_ >= params_.hysteresis)
+            {
+                mp.idle_count_ = 0;
+                if (!shrink(p, ec))
+                    return;
+            }
+        }
+
+        for (std::size_t p = 0; p != pools_.size(); ++p)
+        {
+            managed_pool& mp = pools_[p];
+            if (mp.busy_count_ < params_.hysteresis)
+                continue;
+
+            mp.busy_count_ = 0;
+
+            // use an unused processing unit if there is one
+            bool grown = false;
+            for (std::size_t w : mp.workers_)
+            {
+                if (!workers_[w].active_ && is_pu_free(workers_[w].pu_))
+                {
+                    if (!resume(w, ec))
+                        return;
+                    grown = true;
+                    break;
+                }
+            }
+            if (grown)
+                continue;
+
+            // otherwise borrow a processing unit from the most idle pool
+            // which is not busy itself
+            std::size_t lender = std::size_t(-1);
+            std::size_t lender_worker = std::size_t(-1);
+            std::size_t borrower_worker = std::size_t(-1);
+            for (std::size_t o = 0; o != pools_.size(); ++o)
+            {
+                if (o == p || busy[o] ||
+                    !is_pool_running(*pools_[o].pool_) ||
+                    num_active(pools_[o]) <= params_.min_active_pus ||
+                    (lender != std::size_t(-1) &&
+                        idle_rates[o] <= idle_rates[lender]))
+                {
+                    continue;
+                }
+
+                for (std::size_t w : mp.workers_)
+                {
+                    if (workers_[w].active_)
+                        continue;
+
+                    for (std::size_t ow : pools_[o].workers_)
+                    {
+                        if (workers_[ow].active_ &&
+                            workers_[ow].pu_ == workers_[w].pu_)
+                        {
+                            lender = o;
+                            lender_worker = ow;
+                            borrower_worker = w;
+                            break;
+                        }
+                    }
+                    if (lender == o)
+                        break;
+                }
+            }
+
+            if (lender != std::size_t(-1))
+            {
+                if (!suspend(lender_worker, ec) || !resume(borrower_worker, ec))
+                    return;
+                ++num_lent_;
+            }
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    bool elasticity_controller::shrink(std::size_t p, error_code& ec)
+    {
+        managed_pool& mp = pools_[p];
+        if (num_active(mp) <= params_.min_active_pus)
+            return true;
+
+        // suspend the last active worker thread, the first ones are kept
+        for (auto it = mp.workers_.rbegin(); it != mp.workers_.rend(); ++it)
+        {
+            if (workers_[*it].active_)
+                return suspend(*it, ec);
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t elasticity_controller::num_active(managed_pool const& p) const
+    {
+        std::size_t count = 0;
+        for (std::size_t w : p.workers_)
+        {
+            if (workers_[w].active_)
+                ++count;
+        }
+        return count;
+    }
+
+    bool elasticity_controller::is_pu_free(std::size_t pu) const
+    {
+        for (worker const& w : workers_)
+        {
+            if (w.active_ && w.pu_ == pu)
+                return false;
+        }
+        return true;
+    }
+
+    bool elasticity_controller::suspend(std::size_t w, error_code& ec)
+    {
+        worker& wk = workers_[w];
+        pools_[wk.pool_].pool_->suspend_processing_unit_direct(
+            wk.virt_core_, ec);
+        if (ec)
+            return false;
+
+        wk.active_ = false;
+        ++num_suspended_;
+        return true;
+    }
+
+    bool elasticity_controller::resume(std::size_t w, error_code& ec)
+    {
+        worker& wk = workers_[w];
+        pools_[wk.pool_].pool_->resume_processing_unit_direct(
+            wk.virt_core_, ec);
+        if (ec)
+            return false;
+
+        wk.active_ = true;
+        ++num_resumed_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t elasticity_controller::get_num_active_pus(
+        std::string const& pool) const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        for (managed_pool const& p : pools_)
+        {
+            if (p.pool_->get_pool_name() == pool)
+                return num_active(p);
+        }
+        return 0;
+    }
+
+    std::size_t elasticity_controller::get_num_lent_pus() const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        return num_lent_;
+    }
+
+    std::size_t elasticity_controller::get_num_suspended_pus() const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        return num_suspended_;
+    }
+
+    std::size_t elasticity_controller::get_num_resumed_pus() const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        return num_resumed_;
+    }
+}}    // namespace hpx::threads
@@ -109,6 +109,280 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+        ///////////////////////////////////////////////////////////////////////
+        // locality/pool/worker-thread counter creation function for counters
+        // reporting a percentile (given as the counter parameter)
+        // /threads{locality#%d/total}/time/phase-percentile@99
+        naming::gid_type locality_pool_thread_percentile_counter_creator(
+            threadmanager* tm, threadmanager_percentile_func total_func,
+            threadpool_percentile_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "locality_pool_thread_percentile_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            double percentile =
+                performance_counters::get_counter_percentile(paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            using performance_counters::detail::create_raw_counter;
+
+            thread_pool_base& pool = tm->default_pool();
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                util::function_nonser<std::int64_t(bool)> f =
+                    [tm, total_func, percentile](bool reset) {
+                        return (tm->*total_func)(percentile, reset);
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+            else if (paths.instancename_ == "pool")
+            {
+                if (paths.instanceindex_ >= 0 &&
+                    std::size_t(paths.instanceindex_) <
+                        hpx::resource::get_num_thread_pools())
+                {
+                    // specific for given pool counter
+                    thread_pool_base* pool_instance =
+                        &hpx::resource::get_thread_pool(paths.instanceindex_);
+                    std::size_t num_thread =
+                        static_cast<std::size_t>(paths.subinstanceindex_);
+
+                    util::function_nonser<std::int64_t(bool)> f =
+                        [pool_instance, pool_func, num_thread, percentile](
+                            bool reset) {
+                            return (pool_instance->*pool_func)(
+                                num_thread, percentile, reset);
+                        };
+                    return create_raw_counter(info, std::move(f), ec);
+                }
+            }
+            else if (paths.instancename_ == "worker-thread" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+            {
+                // specific counter from default
+                thread_pool_base* pool_instance = &pool;
+                std::size_t num_thread =
+                    static_cast<std::size_t>(paths.instanceindex_);
+
+                util::function_nonser<std::int64_t(bool)> f =
+                    [pool_instance, pool_func, num_thread, percentile](
+                        bool reset) {
+                        return (pool_instance->*pool_func)(
+                            num_thread, percentile, reset);
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter,
+                "locality_pool_thread_percentile_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // locality/pool/worker-thread counter creation function for the
+        // processing time spent on behalf of a tenant (given by name as the
+        // counter parameter)
+        // /threads{locality#%d/total}/time/tenant-cpu@tenant_name
+        naming::gid_type tenant_cpu_time_counter_creator(threadmanager* tm,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "tenant_cpu_time_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            tenant_id tenant = default_tenant;
+            if (!paths.parameters_.empty())
+            {
+                tenant = get_tenant_id(paths.parameters_, ec);
+                if (ec)
+                    return naming::invalid_gid;
+            }
+
+            using performance_counters::detail::create_raw_counter;
+
+            thread_pool_base& pool = tm->default_pool();
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                util::function_nonser<std::int64_t(bool)> f =
+                    [tm, tenant](bool reset) {
+                        return tm->get_tenant_cpu_time(tenant, reset);
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+            else if (paths.instancename_ == "pool")
+            {
+                if (paths.instanceindex_ >= 0 &&
+                    std::size_t(paths.instanceindex_) <
+                        hpx::resource::get_num_thread_pools())
+                {
+                    // specific for given pool counter
+                    thread_pool_base* pool_instance =
+                        &hpx::resource::get_thread_pool(paths.instanceindex_);
+                    std::size_t num_thread =
+                        static_cast<std::size_t>(paths.subinstanceindex_);
+
+                    util::function_nonser<std::int64_t(bool)> f =
+                        [pool_instance, tenant, num_thread](bool reset) {
+                            return pool_instance->get_tenant_cpu_time(
+                                tenant, num_thread, reset);
+                        };
+                    return create_raw_counter(info, std::move(f), ec);
+                }
+            }
+            else if (paths.instancename_ == "worker-thread" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+            {
+                // specific counter from default
+                thread_pool_base* pool_instance = &pool;
+                std::size_t num_thread =
+                    static_cast<std::size_t>(paths.instanceindex_);
+
+                util::function_nonser<std::int64_t(bool)> f =
+                    [pool_instance, tenant, num_thread](bool reset) {
+                        return pool_instance->get_tenant_cpu_time(
+                            tenant, num_thread, reset);
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter, "tenant_cpu_time_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // locality/pool/worker-thread counter creation function for the
+        // number of tasks stolen from worker threads at the distance given
+        // as the counter parameter (all distances if none is given)
+        // /threads{locality#%d/total}/count/stolen-at-distance@numa
+        naming::gid_type stolen_at_distance_counter_creator(threadmanager* tm,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "stolen_at_distance_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            std::size_t first = 0;
+            std::size_t last = policies::num_steal_distances;
+            if (!paths.parameters_.empty())
+            {
+                first = static_cast<std::size_t>(
+                    policies::get_steal_distance(paths.parameters_, ec));
+                if (ec)
+                    return naming::invalid_gid;
+                last = first + 1;
+            }
+
+            using performance_counters::detail::create_raw_counter;
+
+            thread_pool_base& pool = tm->default_pool();
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                util::function_nonser<std::int64_t(bool)> f =
+                    [tm, first, last](bool reset) {
+                        std::int64_t result = 0;
+                        for (std::size_t d = first; d != last; ++d)
+                        {
+                            result += tm->get_num_stolen_at_distance(
+                                policies::steal_distance(d), reset);
+                        }
+                        return result;
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+
+            thread_pool_base* pool_instance = nullptr;
+            std::size_t num_thread = 0;
+            if (paths.instancename_ == "pool")
+            {
+                if (paths.instanceindex_ >= 0 &&
+                    std::size_t(paths.instanceindex_) <
+                        hpx::resource::get_num_thread_pools())
+                {
+                    // specific for given pool counter
+                    pool_instance =
+                        &hpx::resource::get_thread_pool(paths.instanceindex_);
+                    num_thread =
+                        static_cast<std::size_t>(paths.subinstanceindex_);
+                }
+            }
+            else if (paths.instancename_ == "worker-thread" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+            {
+                // specific counter from default
+                pool_instance = &pool;
+                num_thread = static_cast<std::size_t>(paths.instanceindex_);
+            }
+
+            if (pool_instance != nullptr)
+            {
+                util::function_nonser<std::int64_t(bool)> f =
+                    [pool_instance, num_thread, first, last](bool reset) {
+                        std::int64_t result = 0;
+                        for (std::size_t d = first; d != last; ++d)
+                        {
+                            result += pool_instance->get_num_stolen_at_distance(
+                                num_thread, policies::steal_distance(d), reset);
+                        }
+                        return result;
+                    };
+                return create_raw_counter(info, std::move(f), ec);
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter,
+                "stolen_at_distance_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
+
         // scheduler utilization counter creation function
         naming::gid_type scheduler_utilization_counter_creator(
             threadmanager* tm, performance_counters::counter_info const& info,
@@ -435,6 +709,49 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_queue_length),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            // deadline statistics (local-deadline scheduler only)
+            {"/threads/count/missed-deadlines",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of HPX-threads which have finished after "
+                "their deadline for the referenced worker-thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_num_missed_deadlines,
+                    &thread_pool_base::get_num_missed_deadlines),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/time/average-deadline-lateness",
+                performance_counters::counter_raw,
+                "returns the average time by which the HPX-threads which "
+                "missed their deadline have finished late for the referenced "
+                "worker-thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_average_deadline_lateness,
+                    &thread_pool_base::get_average_deadline_lateness),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            // per-tenant statistics (fair-share scheduler only)
+            {"/threads/count/stolen-at-distance",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of HPX-threads the referenced "
+                "worker-thread stole from worker-threads at the distance "
+                "given as the counter parameter (core, l2, l3, numa, or "
+                "remote; default: all distances)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::stolen_at_distance_counter_creator, &tm),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/time/tenant-cpu",
+                performance_counters::counter_monotonically_increasing,
+                "returns the processing time spent executing HPX-threads of "
+                "the tenant given as the counter parameter (default: "
+                "'default') for the referenced worker-thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::tenant_cpu_time_counter_creator, &tm),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             // average thread wait time for queue(s)
             {"/threads/wait-time/pending",
@@ -533,6 +850,17 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_thread_phase_duration),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
+            {"/threads/time/phase-percentile",
+                performance_counters::counter_raw,
+                "returns the time spent executing one HPX-thread phase at the "
+                "percentile given as the counter parameter (default: 50)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_pool_thread_percentile_counter_creator,
+                    &tm, &threadmanager::get_thread_phase_duration_percentile,
+                    &thread_pool_base::get_thread_phase_duration_percentile),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
             {"/threads/time/average-overhead",
                 performance_counters::counter_average_timer,
                 "returns average overhead time executing one HPX-thread",
@@ -22,6 +22,7 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/itt_notify/thread_name.hpp>
+#include <hpx/logging/format/async_write.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/static_reinit.hpp>
@@ -1327,6 +1328,50 @@ namespace hpx {
         performance_counters::install_counter_types(arithmetic_counter_types,
             sizeof(arithmetic_counter_types) /
                 sizeof(arithmetic_counter_types[0]));
+
+        // counters of the asynchronous logging backend
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> log_written(
+            &util::logging::get_async_written_count);
+        util::function_nonser<std::int64_t(bool)> log_dropped(
+            &util::logging::get_async_dropped_count);
+        util::function_nonser<std::int64_t(bool)> log_overflows(
+            &util::logging::get_async_overflow_count);
+
+        performance_counters::generic_counter_type_data const
+            logging_counter_types[] = {
+                {"/logging/count/written",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of log messages written by the "
+                    "background writer",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, log_written, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/logging/count/dropped",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of log messages discarded as the "
+                    "queue of the background writer was full",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, log_dropped, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/logging/count/overflows",
+                    performance_counters::counter_monotonically_increasing,
+                    "returns the number of log messages which did not fit "
+                    "into the queue of the background writer",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator,
+                        _1, log_overflows, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+            };
+        performance_counters::install_counter_types(logging_counter_types,
+            sizeof(logging_counter_types) / sizeof(logging_counter_types[0]));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,276 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/util/counter_sample_format.hpp>
+#include <hpx/util/counter_sample_sink.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace util {
+    namespace detail {
+        // number of samples which can be staged before samples are dropped
+        constexpr std::size_t counter_sample_staging_rows = 64;
+
+        constexpr std::size_t align_to_entry(std::size_t size)
+        {
+            return (size + counter_sample_entry_size - 1) &
+                ~(counter_sample_entry_size - 1);
+        }
+    }    // namespace detail
+
+    counter_sample_sink::counter_sample_sink(std::string const& filename,
+        std::vector<std::string> const& names,
+        std::vector<std::string> const& units, std::size_t capacity,
+        std::uint32_t locality_id)
+      : num_counters_(names.size())
+      , staging_rows_(detail::counter_sample_staging_rows)
+      , fd_(-1)
+      , data_(nullptr)
+      , size_(0)
+      , header_(nullptr)
+      , staged_timestamps_(staging_rows_)
+      , staged_values_(staging_rows_ * names.size())
+      , staged_head_(0)
+      , staged_tail_(0)
+      , dropped_(0)
+      , stopped_(false)
+    {
+        HPX_ASSERT(names.size() == units.size());
+
+        if (capacity == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "counter_sample_sink::counter_sample_sink",
+                "the capacity of the counter sample file must not be zero");
+        }
+
+#if defined(HPX_WINDOWS)
+        HPX_UNUSED(filename);
+        HPX_UNUSED(locality_id);
+        HPX_THROW_EXCEPTION(not_implemented,
+            "counter_sample_sink::counter_sample_sink",
+            "the binary counter sample sink is not supported on this "
+            "platform");
+#else
+        std::size_t names_size = 0;
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            names_size += names[i].size() + units[i].size() + 2;
+        }
+
+        std::size_t const names_offset =
+            detail::align_to_entry(sizeof(counter_sample_file_header));
+        std::size_t const columns_offset =
+            detail::align_to_entry(names_offset + names_size);
+        size_ = columns_offset +
+            (num_counters_ + 1) * capacity * counter_sample_entry_size;
+
+        fd_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ == -1)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "counter_sample_sink::counter_sample_sink",
+                hpx::util::format("could not open counter sample file "
+                                  "'{}': {}",
+                    filename, std::strerror(errno)));
+        }
+
+        if (::ftruncate(fd_, static_cast<off_t>(size_)) == -1)
+        {
+            int const err = errno;
+            ::close(fd_);
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "counter_sample_sink::counter_sample_sink",
+                hpx::util::format("could not resize counter sample file "
+                                  "'{}': {}",
+                    filename, std::strerror(err)));
+        }
+
+        data_ =
+            ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (data_ == MAP_FAILED)
+        {
+            int const err = errno;
+            ::close(fd_);
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "counter_sample_sink::counter_sample_sink",
+                hpx::util::format("could not map counter sample file "
+                                  "'{}': {}",
+                    filename, std::strerror(err)));
+        }
+
+        // the file is zero filled by ftruncate, fill in header and names
+        char* base = static_cast<char*>(data_);
+
+        header_ = reinterpret_cast<counter_sample_file_header*>(base);
+        std::memcpy(header_->magic_, counter_sample_file_magic,
+            sizeof(counter_sample_file_magic));
+        header_->version_ = counter_sample_file_version;
+        header_->num_counters_ = static_cast<std::uint32_t>(num_counters_);
+        header_->capacity_ = capacity;
+        header_->names_offset_ = names_offset;
+        header_->names_size_ = names_size;
+        header_->columns_offset_ = columns_offset;
+        header_->samples_ = 0;
+        header_->dropped_samples_ = 0;
+        header_->locality_id_ = locality_id;
+
+        char* p = base + names_offset;
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            std::memcpy(p, names[i].c_str(), names[i].size() + 1);
+            p += names[i].size() + 1;
+            std::memcpy(p, units[i].c_str(), units[i].size() + 1);
+            p += units[i].size() + 1;
+        }
+
+        writer_ = std::thread(&counter_sample_sink::run, this);
+#endif
+    }
+
+    counter_sample_sink::~counter_sample_sink()
+    {
+        stop();
+
+#if !defined(HPX_WINDOWS)
+        if (data_ != nullptr)
+        {
+            ::msync(data_, size_, MS_SYNC);
+            ::munmap(data_, size_);
+        }
+        if (fd_ != -1)
+        {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    void counter_sample_sink::push(
+        std::int64_t timestamp, std::vector<double> const& values)
+    {
+        HPX_ASSERT(values.size() == num_counters_);
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (stopped_)
+            {
+                return;
+            }
+
+            if (staged_head_ - staged_tail_ == staging_rows_)
+            {
+                // the writer does not keep up, drop this sample
+                ++dropped_;
+                return;
+            }
+
+            std::size_t const row = staged_head_ % staging_rows_;
+            staged_timestamps_[row] = timestamp;
+            std::copy(values.begin(), values.end(),
+                staged_values_.begin() + row * num_counters_);
+            ++staged_head_;
+        }
+        cond_.notify_one();
+    }
+
+    void counter_sample_sink::stop()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (stopped_)
+            {
+                return;
+            }
+            stopped_ = true;
+        }
+        cond_.notify_one();
+
+        if (writer_.joinable())
+        {
+            writer_.join();
+        }
+    }
+
+    std::uint64_t counter_sample_sink::dropped_samples() const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        return dropped_;
+    }
+
+    void counter_sample_sink::write_sample(std::size_t row)
+    {
+        char* base = static_cast<char*>(data_);
+        std::uint64_t const sample = header_->samples_;
+
+        std::memcpy(base + counter_sample_entry_offset(*header_, 0, sample),
+            &staged_timestamps_[row], counter_sample_entry_size);
+
+        double const* values = staged_values_.data() + row * num_counters_;
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            std::memcpy(
+                base + counter_sample_entry_offset(*header_, i + 1, sample),
+                &values[i], counter_sample_entry_size);
+        }
+
+        // make sure the sample is complete before it is published
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->samples_ = sample + 1;
+    }
+
+    void counter_sample_sink::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (true)
+        {
+            cond_.wait(
+                l, [this]() { return stopped_ || staged_tail_ != staged_head_; });
+
+            // drain all staged samples before honoring a stop request
+            while (staged_tail_ != staged_head_)
+            {
+                std::size_t const row = staged_tail_ % staging_rows_;
+                header_->dropped_samples_ = dropped_;
+
+                // the staged row is not touched by push() before the tail
+                // has been advanced
+                l.unlock();
+                write_sample(row);
+                l.lock();
+
+                ++staged_tail_;
+            }
+
+            if (stopped_)
+            {
+                header_->dropped_samples_ = dropped_;
+                break;
+            }
+        }
+    }
+}}    // namespace hpx::util
+#endif
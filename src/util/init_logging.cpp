@@ -9,6 +9,7 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
 #if defined(HPX_HAVE_LOGGING)
+#include <hpx/logging/format/async_write.hpp>
 #include <hpx/logging/format/named_write.hpp>
 #include <hpx/logging/manipulator.hpp>
 #include <hpx/modules/logging.hpp>
@@ -966,6 +967,16 @@ namespace hpx { namespace util { namespace detail {
         init_hpx_console_log(ini);
         init_app_console_log(ini);
         init_debuglog_console_log(ini);
+
+        // write log messages from a background thread, if requested
+        if (util::get_entry_as<int>(ini, "hpx.logging.async", 0) != 0)
+        {
+            logging::enable_async_writing(
+                util::get_entry_as<std::size_t>(
+                    ini, "hpx.logging.async_queue_size", 4096),
+                util::get_entry_as<int>(
+                    ini, "hpx.logging.async_drop_on_overflow", 1) != 0);
+        }
     }
 }}}    // namespace hpx::util::detail
 
@@ -18,16 +18,21 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/get_thread_name.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/threading_base/external_timer.hpp>
+#include <hpx/util/counter_sample_sink.hpp>
+#include <hpx/util/from_string.hpp>
 #include <hpx/util/query_counters.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -107,6 +112,9 @@ namespace hpx { namespace util
 
         find_counters();
 
+        if (format_ == "binary" && destination_ != "none")
+            create_sample_sink(counters_.get_counter_infos());
+
         counters_.start(launch::sync);
 
         // this will invoke the evaluate function for the first time
@@ -117,6 +125,62 @@ namespace hpx { namespace util
     {
         timer_.stop(terminate);
         counters_.stop(launch::sync);
+
+        // make sure all samples have been written to the file
+        if (sample_sink_)
+            sample_sink_->stop();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        bool is_scalar_counter(performance_counters::counter_info const& info)
+        {
+            return info.type_ != performance_counters::counter_histogram &&
+                info.type_ != performance_counters::counter_raw_values;
+        }
+    }    // namespace detail
+
+    void query_counters::create_sample_sink(
+        std::vector<performance_counters::counter_info> const& infos)
+    {
+        // array valued counters have no fixed size and are not recorded
+        std::vector<std::string> names;
+        std::vector<std::string> units;
+        for (auto const& info : infos)
+        {
+            if (!detail::is_scalar_counter(info))
+                continue;
+
+            names.push_back(
+                performance_counters::remove_counter_prefix(info.fullname_));
+            units.push_back(info.unit_of_measure_);
+        }
+
+        std::size_t capacity = hpx::util::from_string<std::size_t>(
+            get_config_entry("hpx.print_counter.binary_capacity",
+                std::size_t(HPX_INITIAL_COUNTER_SAMPLE_CAPACITY)));
+
+        sample_values_.resize(names.size());
+        sample_sink_.reset(new counter_sample_sink(destination_, names, units,
+            capacity, hpx::get_locality_id()));
+    }
+
+    void query_counters::push_sample(
+        std::vector<performance_counters::counter_value> const& values)
+    {
+        HPX_ASSERT(values.size() == sample_values_.size());
+
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            error_code ec(lightweight);    // do not throw
+            double val = values[i].get_value<double>(ec);
+            sample_values_[i] =
+                ec ? std::numeric_limits<double>::quiet_NaN() : val;
+        }
+
+        sample_sink_->push(
+            static_cast<std::int64_t>(hpx::get_system_uptime()),
+            sample_values_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -528,6 +592,14 @@ namespace hpx { namespace util
 
         HPX_ASSERT(values.size() == indices.size());
 
+        // binary samples are handed to the writer thread of the sink
+        if (sample_sink_)
+        {
+            if (!no_output)
+                push_sample(values);
+            return true;
+        }
+
         // Output the performance counter value.
         if (!no_output)
             print_headers(output, infos);
@@ -580,6 +652,10 @@ namespace hpx { namespace util
         std::vector<performance_counters::counter_values_array> values =
              counters_.get_counter_values_array(launch::sync, reset, ec);
 
+        // array valued counters are not written to binary sample files
+        if (sample_sink_)
+            return true;
+
         HPX_ASSERT(values.size() == indices.size());
 
         // Output the performance counter value.
@@ -7,6 +7,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/task_trace.hpp>
 
 #include "worker_timed.hpp"
 
@@ -14,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -69,6 +71,13 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
 
+    // measure the overhead of recording a task trace, if requested
+    if (vm.count("task-trace"))
+    {
+        hpx::threads::task_trace::enable(hpx::get_os_thread_count(),
+            vm["task-trace-capacity"].as<std::size_t>());
+    }
+
     double seqential_time_per_task = 0;
 
     {
@@ -118,6 +127,16 @@ int hpx_main(hpx::program_options::variables_map& vm)
     hpx::util::print_cdash_timing("AsyncSpeedup",
         seqential_time_per_task/hierarchical_time_per_task);
 
+    if (vm.count("task-trace"))
+    {
+        hpx::threads::task_trace::disable();
+        if (vm.count("task-trace-file"))
+        {
+            hpx::threads::task_trace::dump(
+                vm["task-trace-file"].as<std::string>());
+        }
+    }
+
     return hpx::finalize();
 }
 
@@ -136,6 +155,12 @@ int main(int argc, char* argv[])
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
          "time spent in the delay loop [ns]")
+        ("task-trace", "record a task trace while running the benchmark")
+        ("task-trace-capacity",
+         value<std::size_t>()->default_value(HPX_INITIAL_TASK_TRACE_CAPACITY),
+         "number of task trace events kept per worker thread")
+        ("task-trace-file", value<std::string>(),
+         "write the recorded task trace to the given file")
         ;
 
     // Initialize and run HPX
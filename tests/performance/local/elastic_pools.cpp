@@ -0,0 +1,208 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of two thread pools sharing the same
+// processing units when the load shifts from one pool to the other. Without
+// the elasticity controller the processing units are statically split between
+// the pools, the pool receiving the load can use only half of them. With the
+// elasticity controller the idle pool lends its processing units to the busy
+// pool and the throughput recovers after the load shift.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void busy_wait(std::chrono::microseconds d)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < d)
+    {
+    }
+}
+
+// Run the given number of tasks on the given pool, returns the throughput in
+// tasks per second
+double run_phase(std::string const& pool_name, std::uint64_t num_tasks,
+    std::chrono::microseconds duration)
+{
+    hpx::execution::parallel_executor exec(
+        &hpx::resource::get_thread_pool(pool_name));
+
+    hpx::chrono::high_resolution_timer timer;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::uint64_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(exec, &busy_wait, duration));
+    }
+    hpx::wait_all(tasks);
+
+    return double(num_tasks) / timer.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    auto const duration =
+        std::chrono::microseconds(vm["task-duration"].as<std::uint64_t>());
+
+    hpx::threads::elasticity_parameters params;
+    params.interval =
+        std::chrono::milliseconds(vm["interval"].as<std::uint64_t>());
+    params.hysteresis = vm["hysteresis"].as<std::size_t>();
+
+    // pool B starts without active processing units if all of them are owned
+    // by pool A, an idle pool may give up all of its processing units
+    params.min_active_pus = 0;
+
+    auto& pool_a = hpx::resource::get_thread_pool("A");
+    auto& pool_b = hpx::resource::get_thread_pool("B");
+    std::size_t const num_threads = pool_a.get_os_thread_count();
+
+    std::cout << "mode, threads, phase A [tasks/s], phase B [tasks/s], "
+                 "lent PUs"
+              << std::endl;
+
+    double static_a = 0;
+    double static_b = 0;
+    double elastic_a = 0;
+    double elastic_b = 0;
+
+    for (std::uint64_t i = 0; i != repetitions; ++i)
+    {
+        // static split, each pool runs on half of the processing units
+        for (std::size_t t = 0; t != num_threads; ++t)
+        {
+            if (t < num_threads / 2)
+                pool_b.suspend_processing_unit_direct(t);
+            else if (num_threads > 1)
+                pool_a.suspend_processing_unit_direct(t);
+        }
+
+        double const sa = run_phase("A", num_tasks, duration);
+        double const sb = run_phase("B", num_tasks, duration);
+
+        for (std::size_t t = 0; t != num_threads; ++t)
+        {
+            if (t < num_threads / 2)
+                pool_b.resume_processing_unit_direct(t);
+            else if (num_threads > 1)
+                pool_a.resume_processing_unit_direct(t);
+        }
+
+        std::cout << "static, " << num_threads << ", " << sa << ", " << sb
+                  << ", 0" << std::endl;
+
+        // elastic, pool A initially owns all processing units
+        hpx::threads::elasticity_controller controller({"A", "B"}, params);
+        controller.start();
+
+        double const ea = run_phase("A", num_tasks, duration);
+        double const eb = run_phase("B", num_tasks, duration);
+
+        std::size_t const lent = controller.get_num_lent_pus();
+        controller.stop();
+
+        std::cout << "elastic, " << num_threads << ", " << ea << ", " << eb
+                  << ", " << lent << std::endl;
+
+        static_a += sa;
+        static_b += sb;
+        elastic_a += ea;
+        elastic_b += eb;
+    }
+
+    hpx::util::print_cdash_timing(
+        "StaticPhaseAThroughput", static_a / repetitions);
+    hpx::util::print_cdash_timing(
+        "StaticPhaseBThroughput", static_b / repetitions);
+    hpx::util::print_cdash_timing(
+        "ElasticPhaseAThroughput", elastic_a / repetitions);
+    hpx::util::print_cdash_timing(
+        "ElasticPhaseBThroughput", elastic_b / repetitions);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline;
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks",
+         hpx::program_options::value<std::uint64_t>()->default_value(10000),
+         "number of tasks run in each phase")
+        ("task-duration",
+         hpx::program_options::value<std::uint64_t>()->default_value(100),
+         "duration of each task in microseconds")
+        ("repetitions",
+         hpx::program_options::value<std::uint64_t>()->default_value(3),
+         "number of repetitions")
+        ("interval",
+         hpx::program_options::value<std::uint64_t>()->default_value(5),
+         "interval between the evaluations of the elasticity controller "
+         "in milliseconds")
+        ("hysteresis",
+         hpx::program_options::value<std::size_t>()->default_value(2),
+         "number of consecutive evaluations a pool has to be busy or idle "
+         "before it is resized");
+    // clang-format on
+
+    hpx::init_params iparams;
+    iparams.desc_cmdline = desc_commandline;
+
+    // the pools A and B share the same processing units
+    iparams.rp_mode = hpx::resource::mode_allow_oversubscription;
+    iparams.rp_callback = [](hpx::resource::partitioner& rp) {
+        auto const mode = hpx::threads::policies::scheduler_mode(
+            hpx::threads::policies::default_mode |
+            hpx::threads::policies::enable_elasticity);
+
+        rp.create_thread_pool(
+            "A", hpx::resource::scheduling_policy::local_priority_fifo, mode);
+        rp.create_thread_pool(
+            "B", hpx::resource::scheduling_policy::local_priority_fifo, mode);
+
+        // the default pool keeps the first processing unit for itself if
+        // there is more than one
+        std::vector<hpx::resource::pu> pus;
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    pus.push_back(p);
+                }
+            }
+        }
+
+        rp.add_resource(pus[0], rp.get_default_pool_name());
+        for (std::size_t i = pus.size() > 1 ? 1 : 0; i != pus.size(); ++i)
+        {
+            rp.add_resource(pus[i], "A");
+            rp.add_resource(pus[i], "B");
+        }
+    };
+
+    return hpx::init(argc, argv, iparams);
+}
@@ -14,6 +14,7 @@
 #endif
 #include <hpx/async_combinators/wait_each.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/futures/task.hpp>
 #include <hpx/executors/limiting_executor.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/apply.hpp>
@@ -518,6 +519,67 @@ void measure_function_futures_apply_hierarchical_placement(
         duration, csv);
 }
 
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<double> null_task()
+{
+    co_return null_function();
+}
+
+hpx::task<double> null_task_chain(std::uint64_t depth)
+{
+    if (depth == 0)
+        co_return null_function();
+    co_return co_await null_task_chain(depth - 1);
+}
+
+// Time spawning tasks using wait all on the futures of the tasks
+void measure_function_tasks_wait_all(std::uint64_t count, bool csv)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(hpx::spawn(null_task()));
+    wait_all(futures);
+
+    const double duration = walltime.elapsed();
+    print_stats("spawn", "WaitAll", "task", count, duration, csv);
+}
+
+// Time a chain of tasks awaiting each other, only the outermost task has a
+// future
+void measure_function_tasks_chain(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    global_scratch += hpx::spawn(null_task_chain(count)).get();
+
+    const double duration = walltime.elapsed();
+    print_stats("co_await", "Chain", "task", count, duration, csv);
+}
+
+// Time a chain of continuations of the same length, each continuation has a
+// future
+void measure_function_futures_chain(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    future<double> f = hpx::make_ready_future(null_function());
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        f = f.then(hpx::launch::sync,
+            [](future<double>&& f) { return f.get() + null_function(); });
+    }
+    global_scratch += f.get();
+
+    const double duration = walltime.elapsed();
+    print_stats("then", "Chain", "sync", count, duration, csv);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
@@ -575,6 +637,11 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
                     count, csv);
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+                measure_function_tasks_wait_all(count, csv);
+                measure_function_tasks_chain(count, csv);
+                measure_function_futures_chain(count, csv);
+#endif
             }
         }
     }
@@ -10,11 +10,15 @@
 #include <hpx/chrono.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/compute.hpp>
+#include <hpx/include/partitioned_vector.hpp>
 #include <hpx/include/partitioned_vector_predef.hpp>
 #include <hpx/iostream.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <stdexcept>
 #include <string>
@@ -27,6 +31,15 @@
 // The vector types to be used are defined in partitioned_vector module.
 // HPX_REGISTER_PARTITIONED_VECTOR(int);
 
+// The partitions of this vector type are bound to the NUMA domains they are
+// placed on (see hpx::compute::host::numa_layout)
+typedef hpx::compute::host::block_allocator<double> numa_allocator_double;
+typedef hpx::compute::vector<double, numa_allocator_double> numa_vector_double;
+HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(
+    double, numa_vector_double, numa_vector_double);
+HPX_REGISTER_PARTITIONED_VECTOR(
+    double, numa_vector_double, numa_vector_double);
+
 ///////////////////////////////////////////////////////////////////////////////
 int delay = 1000;
 int test_count = 100;
@@ -60,6 +73,96 @@ std::uint64_t foreach_vector(Policy&& policy, Vector const& v)
     return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// STREAM-style kernels, these are invoked through actions by the segmented
+// algorithms
+struct stream_copy
+{
+    double operator()(double val) const
+    {
+        return val;
+    }
+};
+
+struct stream_scale
+{
+    void operator()(double& val) const
+    {
+        val *= 3.0;
+    }
+};
+
+// measure the best bandwidth (in GB/s) of the copy, scale, and sum kernels
+template <typename Vector>
+void stream_vector(char const* name, Vector& a, Vector& b, int iterations)
+{
+    std::uint64_t copy_time = std::uint64_t(-1);
+    std::uint64_t scale_time = std::uint64_t(-1);
+    std::uint64_t sum_time = std::uint64_t(-1);
+    double sum = 0.0;
+
+    for (int i = 0; i != iterations; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        hpx::parallel::transform(hpx::execution::par, a.begin(), a.end(),
+            b.begin(), stream_copy());
+        copy_time = (std::min)(
+            copy_time, hpx::chrono::high_resolution_clock::now() - start);
+
+        start = hpx::chrono::high_resolution_clock::now();
+        hpx::for_each(hpx::execution::par, b.begin(), b.end(), stream_scale());
+        scale_time = (std::min)(
+            scale_time, hpx::chrono::high_resolution_clock::now() - start);
+
+        start = hpx::chrono::high_resolution_clock::now();
+        sum = hpx::reduce(hpx::execution::par, a.begin(), a.end(), 0.0,
+            std::plus<double>());
+        sum_time = (std::min)(
+            sum_time, hpx::chrono::high_resolution_clock::now() - start);
+    }
+
+    double const size = static_cast<double>(a.size());
+    hpx::cout << name << ": copy " << 2 * sizeof(double) * size / copy_time
+              << " GB/s, scale " << 2 * sizeof(double) * size / scale_time
+              << " GB/s, sum " << sizeof(double) * size / sum_time
+              << " GB/s\n";
+
+    if (sum != size)
+    {
+        hpx::cout << name << ": unexpected result of sum kernel: " << sum
+                  << "\n";
+    }
+}
+
+void stream_tests(std::size_t stream_size, int iterations)
+{
+    std::size_t num_domains = hpx::compute::host::numa_domains().size();
+
+    // partitions allocated from the default heap, touched by the thread
+    // constructing them
+    {
+        hpx::partitioned_vector<double> a(
+            stream_size, 1.0, hpx::container_layout(num_domains));
+        hpx::partitioned_vector<double> b(
+            stream_size, 0.0, hpx::container_layout(num_domains));
+
+        stream_vector("hpx::partitioned_vector<double>(container_layout)", a,
+            b, iterations);
+    }
+
+    // each partition bound to one NUMA domain, the segmented algorithms run
+    // on the cores of that domain
+    {
+        hpx::partitioned_vector<double, numa_vector_double> a(
+            stream_size, 1.0, hpx::compute::host::numa_layout);
+        hpx::partitioned_vector<double, numa_vector_double> b(
+            stream_size, 0.0, hpx::compute::host::numa_layout);
+
+        stream_vector("hpx::partitioned_vector<double>(numa_layout)", a, b,
+            iterations);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -68,6 +171,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     delay = vm["work_delay"].as<int>();
     test_count = vm["test_count"].as<int>();
     chunk_size = vm["chunk_size"].as<int>();
+    std::size_t stream_size = vm["stream_size"].as<std::size_t>();
+    int stream_iterations = vm["stream_iterations"].as<int>();
 
     // verify that input is within domain of program
     if (test_count == 0 || test_count < 0)
@@ -138,6 +243,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
                     double(par_ref)    //-V106
                       << "\n";
         }
+
+        if (stream_size != 0 && stream_iterations > 0)
+        {
+            stream_tests(stream_size, stream_iterations);
+        }
     }
 
     return hpx::finalize();
@@ -169,6 +279,17 @@ int main(int argc, char* argv[])
         ("chunk_size"
         , hpx::program_options::value<int>()->default_value(0)
         , "number of iterations to combine while parallelization (default: 0)")
+
+        ("stream_size"
+        , hpx::program_options::value<std::size_t>()->default_value(4194304)
+        , "size of the vectors used for the STREAM-style comparison of the "
+          "default and the NUMA aware partitioned_vector layout, 0 disables "
+          "the comparison (default: 4194304)")
+
+        ("stream_iterations"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of STREAM-style iterations, the best result is reported "
+          "(default: 10)")
         ;
     // clang-format on
 
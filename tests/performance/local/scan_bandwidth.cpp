@@ -0,0 +1,142 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the memory bandwidth achieved by the scan based algorithms when
+// using the (default) dataflow based scan partitioner and the single-pass
+// scan with decoupled look-back (selected by the lookback_scan executor
+// parameters).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_scan.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using element_type = std::uint32_t;
+
+// bytes read and written by an inclusive scan of the given number of elements
+double scan_bytes(std::size_t size)
+{
+    return 2.0 * static_cast<double>(size * sizeof(element_type));
+}
+
+template <typename ExPolicy>
+double measure_inclusive_scan(ExPolicy&& policy,
+    std::vector<element_type> const& data, std::vector<element_type>& result,
+    int test_count)
+{
+    // warm up
+    hpx::inclusive_scan(policy, data.begin(), data.end(), result.begin());
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::inclusive_scan(policy, data.begin(), data.end(), result.begin());
+    }
+    return (hpx::chrono::high_resolution_clock::now() - start) /
+        (test_count * 1e9);
+}
+
+template <typename ExPolicy>
+double measure_copy_if(ExPolicy&& policy,
+    std::vector<element_type> const& data, std::vector<element_type>& result,
+    int test_count)
+{
+    auto pred = [](element_type v) { return (v & 1) != 0; };
+
+    // warm up
+    hpx::copy_if(policy, data.begin(), data.end(), result.begin(), pred);
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::copy_if(policy, data.begin(), data.end(), result.begin(), pred);
+    }
+    return (hpx::chrono::high_resolution_clock::now() - start) /
+        (test_count * 1e9);
+}
+
+void print_result(std::string const& name, std::size_t size, double time)
+{
+    std::cout << name << ": " << time << " [s], "
+              << scan_bytes(size) / time / 1e9 << " [GB/s]\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const tile_size = vm["tile_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cerr << "test_count must be larger than zero\n";
+        return hpx::finalize();
+    }
+
+    std::vector<element_type> data(vector_size);
+    std::vector<element_type> result(vector_size);
+    for (std::size_t i = 0; i != vector_size; ++i)
+    {
+        data[i] = static_cast<element_type>(i);
+    }
+
+    using namespace hpx::execution;
+
+    std::cout << "vector_size: " << vector_size
+              << ", threads: " << hpx::get_os_thread_count()
+              << ", test_count: " << test_count << "\n";
+
+    print_result("inclusive_scan (dataflow)", vector_size,
+        measure_inclusive_scan(par, data, result, test_count));
+    print_result("inclusive_scan (lookback)", vector_size,
+        measure_inclusive_scan(
+            par.with(lookback_scan(tile_size)), data, result, test_count));
+
+    print_result("copy_if (dataflow)", vector_size,
+        measure_copy_if(par, data, result, test_count));
+    print_result("copy_if (lookback)", vector_size,
+        measure_copy_if(
+            par.with(lookback_scan(tile_size)), data, result, test_count));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(100000000),
+         "number of elements to scan (default: 1e8)")
+        ("tile_size", value<std::size_t>()->default_value(0),
+         "number of elements per tile of the single-pass scan "
+         "(default: 0, derived from the number of cores)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
+#endif
@@ -0,0 +1,95 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency of the distributed barriers, every
+// locality participates in each barrier. Run it with several localities, for
+// instance on a single host:
+//
+//     hpxrun.py -l 8 -t 1 barrier_latency
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Barrier>
+double measure(Barrier& b, std::uint64_t iterations)
+{
+    // make sure all localities start at the same time
+    b.wait();
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        b.wait();
+    }
+    return timer.elapsed() / iterations;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    bool const print = hpx::get_locality_id() == 0;
+
+    double barrier_latency = 0;
+    {
+        hpx::lcos::barrier b("/benchmark/barrier_latency/barrier");
+        barrier_latency = measure(b, iterations);
+    }
+
+    double dissemination_latency = 0;
+    std::size_t rounds = 0;
+    {
+        hpx::lcos::dissemination_barrier b(
+            "/benchmark/barrier_latency/dissemination_barrier");
+        rounds = b.get_num_rounds();
+        dissemination_latency = measure(b, iterations);
+    }
+
+    if (print)
+    {
+        std::cout << "localities, barrier [s], dissemination_barrier [s], "
+                     "rounds"
+                  << std::endl;
+        std::cout << num_localities << ", " << barrier_latency << ", "
+                  << dissemination_latency << ", " << rounds << std::endl;
+
+        hpx::util::print_cdash_timing("BarrierLatency", barrier_latency);
+        hpx::util::print_cdash_timing(
+            "DisseminationBarrierLatency", dissemination_latency);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations",
+         hpx::program_options::value<std::uint64_t>()->default_value(1000),
+         "number of barriers to measure");
+    // clang-format on
+
+    // all localities run hpx_main
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the rate of small messages the parcel layer
+// sustains if many threads send concurrently to all other localities. Run it
+// with several localities and worker threads, for instance on a single host:
+//
+//     hpxrun.py -l 4 -t 4 message_rate
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> messages_received(0);
+
+void message_sink()
+{
+    ++messages_received;
+}
+HPX_PLAIN_ACTION(message_sink, message_sink_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void send_messages(
+    std::vector<hpx::id_type> const& targets, std::uint64_t messages)
+{
+    message_sink_action act;
+    for (std::uint64_t i = 0; i != messages; ++i)
+    {
+        for (hpx::id_type const& target : targets)
+        {
+            hpx::apply(act, target);
+        }
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const messages = vm["messages"].as<std::uint64_t>();
+    std::size_t senders = vm["senders"].as<std::size_t>();
+    if (senders == 0)
+        senders = hpx::get_os_thread_count();
+
+    std::vector<hpx::id_type> const targets = hpx::find_remote_localities();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    bool const print = hpx::get_locality_id() == 0;
+
+    // every locality receives the same number of messages from all others
+    std::uint64_t const expected = messages * senders * targets.size();
+
+    hpx::lcos::barrier b("/benchmark/message_rate/barrier");
+    b.wait();
+
+    hpx::chrono::high_resolution_timer timer;
+
+    std::vector<hpx::future<void>> sending;
+    sending.reserve(senders);
+    for (std::size_t i = 0; i != senders; ++i)
+    {
+        sending.push_back(hpx::async(&send_messages, std::cref(targets),
+            messages));
+    }
+    hpx::wait_all(sending);
+
+    hpx::util::yield_while(
+        [&]() { return messages_received.load() < expected; },
+        "message_rate");
+
+    // all messages have arrived once every locality has passed the barrier
+    b.wait();
+    double const elapsed = timer.elapsed();
+
+    if (print)
+    {
+        double const total = double(expected) * num_localities;
+
+        std::cout << "localities, senders, messages, time [s], "
+                     "rate [msgs/s]"
+                  << std::endl;
+        std::cout << num_localities << ", " << senders << ", " << total
+                  << ", " << elapsed << ", " << total / elapsed << std::endl;
+
+        hpx::util::print_cdash_timing("MessageRate", elapsed);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("messages",
+         hpx::program_options::value<std::uint64_t>()->default_value(10000),
+         "number of messages each sender sends to every other locality")
+        ("senders",
+         hpx::program_options::value<std::size_t>()->default_value(0),
+         "number of concurrently sending threads on each locality "
+         "(default: number of worker threads)");
+    // clang-format on
+
+    // all localities run hpx_main
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
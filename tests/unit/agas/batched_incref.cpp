@@ -0,0 +1,205 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that staging and batching of incref requests keeps objects alive
+// while references are copied between localities and that the objects are
+// destroyed once all references have gone out of scope.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime/agas/interface.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+#include "components/simple_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using std::chrono::milliseconds;
+
+using hpx::naming::id_type;
+
+using hpx::components::component_type;
+using hpx::components::get_component_type;
+
+using hpx::agas::garbage_collect;
+
+using hpx::test::managed_refcnt_monitor;
+using hpx::test::simple_refcnt_monitor;
+
+using hpx::cout;
+using hpx::flush;
+
+///////////////////////////////////////////////////////////////////////////////
+// References stored on each locality
+hpx::lcos::local::spinlock stored_mtx;
+std::vector<id_type> stored;
+
+void store_reference(id_type const& id)
+{
+    std::lock_guard<hpx::lcos::local::spinlock> l(stored_mtx);
+    stored.push_back(id);
+}
+HPX_PLAIN_ACTION(store_reference);
+
+void release_references()
+{
+    std::vector<id_type> ids;
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(stored_mtx);
+        std::swap(ids, stored);
+    }
+}
+HPX_PLAIN_ACTION(release_references);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>().get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Client>
+void hpx_test_main(variables_map& vm)
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::size_t const copies = vm["copies"].as<std::size_t>();
+
+    typedef typename Client::server_type server_type;
+
+    component_type ctype = get_component_type<server_type>();
+    std::vector<id_type> remote_localities = hpx::find_remote_localities(ctype);
+
+    if (remote_localities.empty())
+        throw std::logic_error("this test cannot be run on one locality");
+
+    id_type const here = hpx::find_here();
+    id_type const there = remote_localities[0];
+
+    // The object lives on the remote locality, increfs issued by this
+    // locality are staged and sent in batches.
+    Client monitor(there);
+
+    {
+        id_type id = monitor.detach().get();
+
+        // Copying the reference to other localities splits its credits
+        // until they are exhausted, which causes increfs to be issued.
+        std::vector<hpx::future<void>> stores;
+        stores.reserve(2 * copies);
+        for (std::size_t i = 0; i != copies; ++i)
+        {
+            stores.push_back(hpx::async<store_reference_action>(there, id));
+            stores.push_back(hpx::async<store_reference_action>(here, id));
+        }
+        hpx::wait_all(stores);
+
+        for (auto& f : stores)
+        {
+            HPX_TEST(!f.has_exception());
+        }
+    }
+
+    // Flush pending reference counting operations.
+    garbage_collect(there);
+    garbage_collect();
+
+    // The object should still be alive as references are stored.
+    HPX_TEST_EQ(false, monitor.is_ready(milliseconds(delay)));
+
+    hpx::async<release_references_action>(there).get();
+    hpx::async<release_references_action>(here).get();
+
+    // Flush pending reference counting operations.
+    garbage_collect(there);
+    garbage_collect();
+    garbage_collect(there);
+    garbage_collect();
+
+    // The object should be out of scope now.
+    HPX_TEST_EQ(true, monitor.is_ready(milliseconds(delay)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        cout << std::string(80, '#') << "\n"
+             << "simple component test\n"
+             << std::string(80, '#') << "\n"
+             << flush;
+
+        hpx_test_main<simple_refcnt_monitor>(vm);
+
+        cout << std::string(80, '#') << "\n"
+             << "managed component test\n"
+             << std::string(80, '#') << "\n"
+             << flush;
+
+        hpx_test_main<managed_refcnt_monitor>(vm);
+    }
+
+    // At least the decref requests issued above have been sent in batches.
+    std::int64_t batches =
+        get_counter_value("/agas{locality#0/total}/count/refcnt/batches");
+    std::int64_t coalesced = get_counter_value(
+        "/agas{locality#0/total}/count/refcnt/coalesced_credits");
+
+    cout << "batches: " << batches << ", coalesced credits: " << coalesced
+         << "\n"
+         << flush;
+
+    HPX_TEST_LT(std::int64_t(0), batches);
+    HPX_TEST_LTE(std::int64_t(0), coalesced);
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("delay", value<std::uint64_t>()->default_value(1000),
+            "number of milliseconds to wait for object destruction")
+        ("copies", value<std::size_t>()->default_value(100),
+            "number of references to send to each locality")
+        ;
+    // clang-format on
+
+    // We need to explicitly enable the test components used by this test.
+    // Stage a small number of increfs to exercise both, size based and timed
+    // flushing.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.max_pending_incref_requests = 4",
+        "hpx.agas.incref_flush_delay = 100"};
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv, cfg);
+}
+#endif
@@ -0,0 +1,130 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/util/counter_sample_format.hpp>
+#include <hpx/util/counter_sample_sink.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T get_entry(std::vector<char> const& data,
+    hpx::util::counter_sample_file_header const& header, std::uint64_t column,
+    std::uint64_t sample)
+{
+    T value;
+    std::memcpy(&value,
+        data.data() +
+            hpx::util::counter_sample_entry_offset(header, column, sample),
+        sizeof(T));
+    return value;
+}
+
+void test_counter_sample_sink()
+{
+    std::string const filename =
+        "counter_sample_sink." + std::to_string(hpx::get_locality_id()) + ".bin";
+
+    std::vector<std::string> const names = {"/test/first", "/test/second"};
+    std::vector<std::string> const units = {"", "ns"};
+
+    std::size_t const capacity = 8;
+    std::size_t const samples = 20;
+
+    {
+        hpx::util::counter_sample_sink sink(
+            filename, names, units, capacity, 0);
+
+        std::vector<double> values(names.size());
+        for (std::size_t i = 0; i != samples; ++i)
+        {
+            values[0] = static_cast<double>(i);
+            values[1] = i == samples - 1 ?
+                std::numeric_limits<double>::quiet_NaN() :
+                static_cast<double>(2 * i);
+            sink.push(static_cast<std::int64_t>(100 * i), values);
+        }
+
+        sink.stop();
+    }
+
+    std::vector<char> data;
+    {
+        std::ifstream in(filename, std::ios::binary);
+        HPX_TEST(in.good());
+        data.assign(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+    }
+    std::remove(filename.c_str());
+
+    hpx::util::counter_sample_file_header header;
+    HPX_TEST_LTE(sizeof(header), data.size());
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    HPX_TEST_EQ(std::memcmp(header.magic_,
+                    hpx::util::counter_sample_file_magic,
+                    sizeof(hpx::util::counter_sample_file_magic)),
+        0);
+    HPX_TEST_EQ(header.version_, hpx::util::counter_sample_file_version);
+    HPX_TEST_EQ(header.num_counters_, std::uint32_t(names.size()));
+    HPX_TEST_EQ(header.capacity_, std::uint64_t(capacity));
+
+    // the writer may have dropped samples if it could not keep up
+    HPX_TEST_EQ(header.samples_ + header.dropped_samples_,
+        std::uint64_t(samples));
+
+    // verify names and units of measure
+    char const* p = data.data() + header.names_offset_;
+    for (std::size_t i = 0; i != names.size(); ++i)
+    {
+        HPX_TEST_EQ(std::string(p), names[i]);
+        p += names[i].size() + 1;
+        HPX_TEST_EQ(std::string(p), units[i]);
+        p += units[i].size() + 1;
+    }
+
+    // the ring holds the most recent samples, samples are written in order
+    std::uint64_t first =
+        header.samples_ > capacity ? header.samples_ - capacity : 0;
+    std::int64_t last_time = -1;
+    for (std::uint64_t s = first; s != header.samples_; ++s)
+    {
+        std::int64_t time = get_entry<std::int64_t>(data, header, 0, s);
+        double first_value = get_entry<double>(data, header, 1, s);
+        double second_value = get_entry<double>(data, header, 2, s);
+
+        HPX_TEST_LT(last_time, time);
+        last_time = time;
+
+        HPX_TEST_EQ(first_value, static_cast<double>(time / 100));
+        if (time / 100 == std::int64_t(samples - 1))
+            HPX_TEST(std::isnan(second_value));
+        else
+            HPX_TEST_EQ(second_value, 2 * first_value);
+    }
+}
+#endif
+
+int main()
+{
+#if !defined(HPX_WINDOWS)
+    test_counter_sample_sink();
+#endif
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,299 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Convert the binary performance counter sample files written with
+// --hpx:print-counter-format=binary to CSV or JSON.
+//
+// usage: counter_sample_converter [--csv|--json] <file> [<output>]
+
+#include <hpx/util/counter_sample_format.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using hpx::util::counter_sample_file_header;
+
+///////////////////////////////////////////////////////////////////////////////
+struct sample_file
+{
+    counter_sample_file_header header;
+    std::vector<std::string> names;
+    std::vector<std::string> units;
+    std::vector<char> data;
+
+    std::uint64_t first_sample() const
+    {
+        return header.samples_ > header.capacity_ ?
+            header.samples_ - header.capacity_ :
+            0;
+    }
+
+    template <typename T>
+    T entry(std::uint64_t column, std::uint64_t sample) const
+    {
+        T value;
+        std::memcpy(&value,
+            data.data() +
+                hpx::util::counter_sample_entry_offset(header, column, sample),
+            sizeof(T));
+        return value;
+    }
+};
+
+bool read_sample_file(char const* filename, sample_file& f)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+    {
+        std::cerr << "counter_sample_converter: could not open '" << filename
+                  << "'\n";
+        return false;
+    }
+
+    f.data.assign(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+
+    if (f.data.size() < sizeof(counter_sample_file_header))
+    {
+        std::cerr << "counter_sample_converter: '" << filename
+                  << "' is not a counter sample file\n";
+        return false;
+    }
+
+    std::memcpy(&f.header, f.data.data(), sizeof(counter_sample_file_header));
+    if (std::memcmp(f.header.magic_, hpx::util::counter_sample_file_magic,
+            sizeof(hpx::util::counter_sample_file_magic)) != 0)
+    {
+        std::cerr << "counter_sample_converter: '" << filename
+                  << "' is not a counter sample file\n";
+        return false;
+    }
+
+    if (f.header.version_ != hpx::util::counter_sample_file_version)
+    {
+        std::cerr << "counter_sample_converter: unsupported version "
+                  << f.header.version_ << " of '" << filename << "'\n";
+        return false;
+    }
+
+    std::uint64_t const expected_size = f.header.columns_offset_ +
+        (f.header.num_counters_ + 1) * f.header.capacity_ *
+            hpx::util::counter_sample_entry_size;
+    if (f.header.capacity_ == 0 || f.data.size() < expected_size ||
+        f.header.names_offset_ + f.header.names_size_ > f.data.size())
+    {
+        std::cerr << "counter_sample_converter: '" << filename
+                  << "' is truncated\n";
+        return false;
+    }
+
+    // extract counter names and units of measure
+    char const* p = f.data.data() + f.header.names_offset_;
+    char const* end = p + f.header.names_size_;
+    for (std::uint32_t i = 0; i != f.header.num_counters_; ++i)
+    {
+        char const* term = std::find(p, end, '\0');
+        if (term == end)
+            break;
+        f.names.emplace_back(p, term);
+        p = term + 1;
+
+        term = std::find(p, end, '\0');
+        if (term == end)
+            break;
+        f.units.emplace_back(p, term);
+        p = term + 1;
+    }
+
+    if (f.names.size() != f.header.num_counters_ ||
+        f.units.size() != f.header.num_counters_)
+    {
+        std::cerr << "counter_sample_converter: '" << filename
+                  << "' has a corrupt names section\n";
+        return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_csv_name(std::ostream& out, std::string const& name)
+{
+    if (name.find_first_of(",\"") == std::string::npos)
+    {
+        out << name;
+        return;
+    }
+
+    out << '"';
+    for (char c : name)
+    {
+        if (c == '"')
+            out << '"';
+        out << c;
+    }
+    out << '"';
+}
+
+void write_csv(std::ostream& out, sample_file const& f)
+{
+    out << "time[ns]";
+    for (std::size_t i = 0; i != f.names.size(); ++i)
+    {
+        out << ",";
+        if (f.units[i].empty())
+            print_csv_name(out, f.names[i]);
+        else
+            print_csv_name(out, f.names[i] + " [" + f.units[i] + "]");
+    }
+    out << "\n";
+
+    for (std::uint64_t s = f.first_sample(); s != f.header.samples_; ++s)
+    {
+        out << f.entry<std::int64_t>(0, s);
+        for (std::size_t i = 0; i != f.names.size(); ++i)
+        {
+            double value = f.entry<double>(i + 1, s);
+            out << ",";
+            if (std::isnan(value))
+                out << "invalid";
+            else
+                out << value;
+        }
+        out << "\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_json_string(std::ostream& out, std::string const& s)
+{
+    out << '"';
+    for (char c : s)
+    {
+        switch (c)
+        {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                    << static_cast<int>(c) << std::dec << std::setfill(' ');
+            }
+            else
+            {
+                out << c;
+            }
+            break;
+        }
+    }
+    out << '"';
+}
+
+void write_json(std::ostream& out, sample_file const& f)
+{
+    out << "{\n  \"locality\": " << f.header.locality_id_
+        << ",\n  \"dropped_samples\": " << f.header.dropped_samples_
+        << ",\n  \"counters\": [";
+    for (std::size_t i = 0; i != f.names.size(); ++i)
+    {
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+        print_json_string(out, f.names[i]);
+        out << ", \"unit\": ";
+        print_json_string(out, f.units[i]);
+        out << "}";
+    }
+    out << "\n  ],\n  \"samples\": [";
+
+    bool first = true;
+    for (std::uint64_t s = f.first_sample(); s != f.header.samples_; ++s)
+    {
+        out << (first ? "\n" : ",\n") << "    {\"time\": "
+            << f.entry<std::int64_t>(0, s) << ", \"values\": [";
+        first = false;
+
+        for (std::size_t i = 0; i != f.names.size(); ++i)
+        {
+            double value = f.entry<double>(i + 1, s);
+            if (i != 0)
+                out << ", ";
+            if (std::isnan(value) || std::isinf(value))
+                out << "null";
+            else
+                out << value;
+        }
+        out << "]}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    bool json = false;
+    std::vector<char const*> args;
+    for (int i = 1; i != argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0)
+            json = true;
+        else if (std::strcmp(argv[i], "--csv") == 0)
+            json = false;
+        else
+            args.push_back(argv[i]);
+    }
+
+    if (args.empty() || args.size() > 2)
+    {
+        std::cerr << "usage: counter_sample_converter [--csv|--json] <file> "
+                     "[<output>]\n";
+        return 1;
+    }
+
+    sample_file f;
+    if (!read_sample_file(args[0], f))
+        return 1;
+
+    std::ofstream outfile;
+    if (args.size() == 2)
+    {
+        outfile.open(args[1]);
+        if (!outfile)
+        {
+            std::cerr << "counter_sample_converter: could not open '"
+                      << args[1] << "'\n";
+            return 1;
+        }
+    }
+    std::ostream& out = args.size() == 2 ? outfile : std::cout;
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    if (json)
+        write_json(out, f);
+    else
+        write_csv(out, f);
+
+    return out ? 0 : 1;
+}